@@ -639,6 +639,7 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", handler != nullptr, "Attempting to register a null asset handler!");
         if (handler)
         {
+            AZStd::unique_lock<AZStd::shared_mutex> handlerLock(m_handlerMutex);
             if (m_handlers.insert(AZStd::make_pair(assetType, handler)).second)
             {
                 handler->m_nHandledTypes++;
@@ -659,44 +660,57 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", handler != nullptr, "Attempting to unregister a null asset handler!");
         if (handler)
         {
-            for (AssetHandlerMap::iterator it = m_handlers.begin(); it != m_handlers.end(); /*++it*/)
+            size_t numTypesRemoved = 0;
             {
-                if (it->second == handler)
+                // Remove the handler from the dispatch map first so no new lookups can return it, then do the
+                // (potentially slow) job drain and asset scan below without holding the handler lock.  Holding
+                // it across WaitForActiveJobsAndStreamerRequestsToFinish() would deadlock against load jobs
+                // performing handler lookups of their own.
+                AZStd::unique_lock<AZStd::shared_mutex> handlerLock(m_handlerMutex);
+                for (AssetHandlerMap::iterator it = m_handlers.begin(); it != m_handlers.end(); /*++it*/)
                 {
-                    // When unregistering asset handlers, it's possible that there are still some load jobs that have "finished" but
-                    // haven't destroyed themselves yet by the time the asset handler gets unregistered.  LoadAssetJob contains a weak
-                    // asset reference that doesn't clear until the job is destroyed, which happens *after* the OnAssetReady
-                    // notification is triggered.  If the thread gets swapped out between the OnAssetReady and the job destruction,
-                    // the job will still be holding onto an asset reference for this asset handler, and it will trigger the
-                    // error below.  To ensure that this case doesn't happen, we will instead call
-                    // WaitForActiveJobsAndStreamerRequestsToFinish() to make sure that any in-process jobs have completely cleaned
-                    // themselves up before proceeding forward.
-                    // One example of this pattern occurs in unit tests, where the test loads an asset, validates it, destroys the
-                    // asset, and unregisters the handler, all in rapid succession.  This would extremely infrequently
-                    // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
-                    WaitForActiveJobsAndStreamerRequestsToFinish();
+                    if (it->second == handler)
+                    {
+                        it = m_handlers.erase(it);
+                        handler->m_nHandledTypes--;
+                        ++numTypesRemoved;
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+
+            if (numTypesRemoved > 0)
+            {
+                // When unregistering asset handlers, it's possible that there are still some load jobs that have "finished" but
+                // haven't destroyed themselves yet by the time the asset handler gets unregistered.  LoadAssetJob contains a weak
+                // asset reference that doesn't clear until the job is destroyed, which happens *after* the OnAssetReady
+                // notification is triggered.  If the thread gets swapped out between the OnAssetReady and the job destruction,
+                // the job will still be holding onto an asset reference for this asset handler, and it will trigger the
+                // error below.  To ensure that this case doesn't happen, we will instead call
+                // WaitForActiveJobsAndStreamerRequestsToFinish() to make sure that any in-process jobs have completely cleaned
+                // themselves up before proceeding forward.
+                // One example of this pattern occurs in unit tests, where the test loads an asset, validates it, destroys the
+                // asset, and unregisters the handler, all in rapid succession.  This would extremely infrequently
+                // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
+                WaitForActiveJobsAndStreamerRequestsToFinish();
 
+                {
+                    // this scope is used to control the scope of the lock.
+                    AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                    for (const auto &assetEntry : m_assets)
                     {
-                        // this scope is used to control the scope of the lock.
-                        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        for (const auto &assetEntry : m_assets)
+                        // is the handler that handles this type, this handler we're removing?
+                        if (assetEntry.second->m_registeredHandler == handler)
                         {
-                            // is the handler that handles this type, this handler we're removing?
-                            if (assetEntry.second->m_registeredHandler == handler)
-                            {
-                                AZ_Error("AssetManager", false, "Asset handler for %s is being removed, when assetid %s is still loaded!\n",
-                                            assetEntry.second->GetType().ToString<AZ::OSString>().c_str(),
-                                            assetEntry.second->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
-                                assetEntry.second->UnregisterWithHandler();
-                            }
+                            AZ_Error("AssetManager", false, "Asset handler for %s is being removed, when assetid %s is still loaded!\n",
+                                        assetEntry.second->GetType().ToString<AZ::OSString>().c_str(),
+                                        assetEntry.second->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
+                            assetEntry.second->UnregisterWithHandler();
                         }
                     }
-                    it = m_handlers.erase(it);
-                    handler->m_nHandledTypes--;
-                }
-                else
-                {
-                    ++it;
                 }
             }
         }
@@ -851,8 +865,13 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
+        return FindAssetInternal(assetToFind, assetReferenceLoadBehavior);
+    }
+
+    Asset<AssetData> AssetManager::FindAssetInternal(const AssetId& canonicalAssetId, AssetLoadBehavior assetReferenceLoadBehavior)
+    {
         AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        AssetMap::iterator it = m_assets.find(assetToFind);
+        AssetMap::iterator it = m_assets.find(canonicalAssetId);
         if (it != m_assets.end())
         {
             Asset<AssetData> asset(assetReferenceLoadBehavior);
@@ -987,6 +1006,16 @@ namespace AZ::Data
         AssetData* assetData = nullptr;
         Asset<AssetData> asset; // Used to hold a reference while job is dispatched and while outside of the assetMutex lock.
 
+        {
+            AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAssetHandler");
+
+            // find the asset type handler - handler registration has its own lock, so the lookup doesn't need
+            // to serialize against other asset operations
+            handler = FindAssetHandler(assetInfo.m_assetType);
+            AZ_Error("AssetDatabase", handler != nullptr, "No handler was registered for this asset [type:%s id:%s]!",
+                assetInfo.m_assetType.ToString<AZ::OSString>().c_str(), assetInfo.m_assetId.ToString<AZ::OSString>().c_str());
+        }
+
         // Control the scope of the assetMutex lock
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
@@ -1008,36 +1037,24 @@ namespace AZ::Data
                 }
             }
 
+            if (handler && isNewEntry)
             {
-                AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAssetHandler");
+                AZ_PROFILE_SCOPE(AzCore, "GetAsset: CreateAsset");
 
-                // find the asset type handler
-                AssetHandlerMap::iterator handlerIt = m_handlers.find(assetInfo.m_assetType);
-                AZ_Error("AssetDatabase", handlerIt != m_handlers.end(), "No handler was registered for this asset [type:%s id:%s]!",
-                    assetInfo.m_assetType.ToString<AZ::OSString>().c_str(), assetInfo.m_assetId.ToString<AZ::OSString>().c_str());
-                if (handlerIt != m_handlers.end())
+                // Create the asset ptr and insert it into our asset map.
+                assetData = handler->CreateAsset(assetInfo.m_assetId, assetInfo.m_assetType);
+                if (assetData)
                 {
-                    // Create the asset ptr and insert it into our asset map.
-                    handler = handlerIt->second;
-                    if (isNewEntry)
-                    {
-                        AZ_PROFILE_SCOPE(AzCore, "GetAsset: CreateAsset");
-
-                        assetData = handler->CreateAsset(assetInfo.m_assetId, assetInfo.m_assetType);
-                        if (assetData)
-                        {
-                            assetData->m_assetId = assetInfo.m_assetId;
-                            assetData->m_creationToken = ++m_creationTokenGenerator;
-                            assetData->RegisterWithHandler(handler);
-                            asset.SetData(assetData);
-                        }
-                        else
-                        {
-                            AZ_Error("AssetDatabase", false, "Failed to create asset with (id=%s, type=%s)",
-                                assetInfo.m_assetId.ToString<AZ::OSString>().c_str(),
-                                assetInfo.m_assetType.ToString<AZ::OSString>().c_str());
-                        }
-                    }
+                    assetData->m_assetId = assetInfo.m_assetId;
+                    assetData->m_creationToken = ++m_creationTokenGenerator;
+                    assetData->RegisterWithHandler(handler);
+                    asset.SetData(assetData);
+                }
+                else
+                {
+                    AZ_Error("AssetDatabase", false, "Failed to create asset with (id=%s, type=%s)",
+                        assetInfo.m_assetId.ToString<AZ::OSString>().c_str(),
+                        assetInfo.m_assetType.ToString<AZ::OSString>().c_str());
                 }
             }
 
@@ -1052,22 +1069,13 @@ namespace AZ::Data
                 {
                     assetData->m_status = AssetData::AssetStatus::Queued;
                     UpdateDebugStatus(asset);
-                    loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
                     wasUnloaded = true;
 
-                    if (loadInfo.IsValid())
-                    {
-                        // Create the AssetDataStream instance here so it can claim an asset reference inside the lock (for a total
-                        // count of 2 before starting the load), otherwise the refcount will be 1, and the load could be canceled
-                        // before it is started, which creates state consistency issues.
+                    // Create the AssetDataStream instance here so it can claim an asset reference inside the lock (for a total
+                    // count of 2 before starting the load), otherwise the refcount will be 1, and the load could be canceled
+                    // before it is started, which creates state consistency issues.
 
-                        dataStream = AZStd::make_shared<AssetDataStream>(handler->GetAssetBufferAllocator());
-                    }
-                    else
-                    {
-                        // Asset creation was successful, but asset loading isn't, so trigger the OnAssetError notification
-                        triggerAssetErrorNotification = true;
-                    }
+                    dataStream = AZStd::make_shared<AssetDataStream>(handler->GetAssetBufferAllocator());
                 }
             }
         }
@@ -1079,6 +1087,20 @@ namespace AZ::Data
 
         asset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
 
+        // Resolve the load stream info outside the lock - it consults the asset catalog and gives the handler
+        // two customization callbacks, none of which need the global asset mutex.  Holding it across these
+        // calls serializes every concurrent asset request behind catalog and handler work.
+        if (wasUnloaded)
+        {
+            loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
+            if (!loadInfo.IsValid())
+            {
+                // Asset creation was successful, but asset loading isn't, so trigger the OnAssetError notification
+                dataStream.reset();
+                triggerAssetErrorNotification = true;
+            }
+        }
+
         // We delay queueing the async file I/O until we release m_assetMutex
         if (dataStream)
         {
@@ -1130,9 +1152,20 @@ namespace AZ::Data
 
     Asset<AssetData> AssetManager::FindOrCreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
     {
+        // Resolve any legacy id to its canonical id before taking the asset mutex.  The catalog query is
+        // comparatively slow, and holding the global lock across it serializes every other asset operation
+        // behind this one - most visible when asset containers create large dependency batches during
+        // level transitions.
+        AZ::Data::AssetInfo assetInfo;
+        if (GetAssetInfoUpgradingEnabled())
+        {
+            AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+        }
+        const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
+
         AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
 
-        Asset<AssetData> asset = FindAsset(assetId, assetReferenceLoadBehavior);
+        Asset<AssetData> asset = FindAssetInternal(assetToFind, assetReferenceLoadBehavior);
 
         if (!asset)
         {
@@ -1155,12 +1188,11 @@ namespace AZ::Data
         if (it == m_assets.end())
         {
             // find the asset type handler
-            AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
-            AZ_Error("AssetDatabase", handlerIt != m_handlers.end(), "No handler was registered for this asset (id=%s, type=%s)!", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
-            if (handlerIt != m_handlers.end())
+            AssetHandler* handler = FindAssetHandler(assetType);
+            AZ_Error("AssetDatabase", handler != nullptr, "No handler was registered for this asset (id=%s, type=%s)!", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
+            if (handler)
             {
                 // Create the asset ptr
-                AssetHandler* handler = handlerIt->second;
                 auto assetData = handler->CreateAsset(assetId, assetType);
                 AZ_Error("AssetDatabase", assetData, "Failed to create asset with (id=%s, type=%s)", assetId.ToString<AZ::OSString>().c_str(), assetType.ToString<AZ::OSString>().c_str());
                 if (assetData)
@@ -1237,10 +1269,9 @@ namespace AZ::Data
             }
 
             // find the asset type handler
-            AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
-            if (handlerIt != m_handlers.end())
+            AssetHandler* handler = FindAssetHandler(assetType);
+            if (handler)
             {
-                AssetHandler* handler = handlerIt->second;
                 if (asset)
                 {
                     handler->DestroyAsset(asset);
@@ -1306,13 +1337,9 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::SaveAsset(const Asset<AssetData>& asset)
     {
-        AssetHandler* handler;
-        {
-            // find the asset type handler
-            AssetHandlerMap::iterator handlerIt = m_handlers.find(asset.GetType());
-            AZ_Assert(handlerIt != m_handlers.end(), "No handler was registered for this asset [type:%s id:%s]!", asset.GetType().ToString<AZ::OSString>().c_str(), asset.GetId().ToString<AZ::OSString>().c_str());
-            handler = handlerIt->second;
-        }
+        // find the asset type handler
+        AssetHandler* handler = FindAssetHandler(asset.GetType());
+        AZ_Assert(handler != nullptr, "No handler was registered for this asset [type:%s id:%s]!", asset.GetType().ToString<AZ::OSString>().c_str(), asset.GetId().ToString<AZ::OSString>().c_str());
 
         // start the data saving
         SaveAssetJob* saveJob = aznew SaveAssetJob(JobContext::GetGlobalContext(), this, asset, handler);
@@ -1382,10 +1409,9 @@ namespace AZ::Data
 
         // Resolve the asset handler and allocate new data for the reload.
         {
-            AssetHandlerMap::iterator handlerIt = m_handlers.find(currentAsset.GetType());
-            AZ_Assert(handlerIt != m_handlers.end(), "No handler was registered for this asset [type:%s id:%s]!",
+            handler = FindAssetHandler(currentAsset.GetType());
+            AZ_Assert(handler != nullptr, "No handler was registered for this asset [type:%s id:%s]!",
                 currentAsset.GetType().ToString<AZ::OSString>().c_str(), currentAsset.GetId().ToString<AZ::OSString>().c_str());
-            handler = handlerIt->second;
 
             newAssetData = handler->CreateAsset(currentAsset.GetId(), currentAsset.GetType());
             if (newAssetData)
@@ -1480,9 +1506,9 @@ namespace AZ::Data
 
                 // Resolve the asset handler and account for the new asset instance.
                 {
-                    [[maybe_unused]] AssetHandlerMap::iterator handlerIt = m_handlers.find(newData->GetType());
+                    [[maybe_unused]] AssetHandler* handler = FindAssetHandler(newData->GetType());
                     AZ_Assert(
-                        handlerIt != m_handlers.end(), "No handler was registered for this asset [type:%s id:%s]!",
+                        handler != nullptr, "No handler was registered for this asset [type:%s id:%s]!",
                         newData->GetType().ToString<AZ::OSString>().c_str(), newData->GetId().ToString<AZ::OSString>().c_str());
                 }
 
@@ -1503,6 +1529,15 @@ namespace AZ::Data
     //=========================================================================
     AssetHandler* AssetManager::GetHandler(const AssetType& assetType)
     {
+        return FindAssetHandler(assetType);
+    }
+
+    //=========================================================================
+    // FindAssetHandler
+    //=========================================================================
+    AssetHandler* AssetManager::FindAssetHandler(const AssetType& assetType) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> handlerLock(m_handlerMutex);
         auto handlerEntry = m_handlers.find(assetType);
         if (handlerEntry != m_handlers.end())
         {
@@ -16,6 +16,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
@@ -354,6 +355,14 @@ namespace AZ
 
             Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false);
 
+            //! Looks up an already-resolved (canonical) asset id in the asset map.  Callers are expected to have
+            //! translated any legacy id through the asset catalog first, outside of the asset mutex.
+            Asset<AssetData> FindAssetInternal(const AssetId& canonicalAssetId, AssetLoadBehavior assetReferenceLoadBehavior);
+
+            //! Looks up the handler registered for the asset type under the shared handler lock.
+            //! Returns nullptr if no handler is registered for the type.
+            AssetHandler* FindAssetHandler(const AssetType& assetType) const;
+
             void UpdateDebugStatus(const AZ::Data::Asset<AZ::Data::AssetData>& asset);
 
             /**
@@ -402,6 +411,7 @@ namespace AZ
                 AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded);
 
             AssetHandlerMap         m_handlers;
+            mutable AZStd::shared_mutex m_handlerMutex; // handler registration is rare, so reads take the shared lock
             AssetCatalogMap         m_catalogs;
             AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
             AssetMap                m_assets;
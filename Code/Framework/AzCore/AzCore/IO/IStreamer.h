@@ -11,6 +11,7 @@
 #include <AzCore/IO/IStreamerTypes.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -295,6 +296,13 @@ namespace AZ::IO
         //! @param requests The requests that will be processed.
         virtual void QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests) = 0;
 
+        //! Queue a batch of requests for processing by Streamer's stack.
+        //! This version accepts any contiguous range of requests so callers don't need to copy into a
+        //! temporary vector first. The entire batch is moved to the scheduler with a single lock and a
+        //! single scheduling thread wakeup.
+        //! @param requests The requests that will be processed.
+        virtual void QueueRequestBatch(AZStd::span<const FileRequestPtr> requests) = 0;
+
         //
         // Streamer request queries
         // The following functions accept FileRequest, FileRequestPtr or FileRequestHandle.
@@ -56,9 +56,15 @@ namespace AZ::IO
     FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
         : StreamStackEntry("Full file decompressor")
         , m_maxNumReads(maxNumReads)
-        , m_maxNumJobs(maxNumJobs)
         , m_alignment(alignment)
     {
+        if (maxNumJobs == 0)
+        {
+            // Scale with the machine, but leave the majority of the cores for the systems consuming the loaded data.
+            maxNumJobs = AZ::GetClamp(AZStd::thread::hardware_concurrency() / 4, 2u, 8u);
+        }
+        m_maxNumJobs = maxNumJobs;
+
         JobManagerDesc jobDesc;
             jobDesc.m_jobManagerName = "Full File Decompressor";
         u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
@@ -320,9 +326,14 @@ namespace AZ::IO
             double averageJobStartDelay = m_decompressionJobDelayMicroSec.CalculateAverage() * usToMs;
             statistics.push_back(Statistic::CreateFloat(m_name, "Decompression job delay (avg. ms)", averageJobStartDelay));
 
+            double averageJobDuration = m_decompressionDurationMicroSec.CalculateAverage() * usToMs;
+            statistics.push_back(Statistic::CreateFloat(m_name, "Decompression job duration (avg. ms)", averageJobDuration));
+
             double totalBytesDecompressedMB = m_bytesDecompressed.GetTotal() * bytesToMB;
             double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
             statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per job (avg. mbps)", totalBytesDecompressedMB / totalDecompressionTimeSec));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed total (avg. mbps)",
+                (totalBytesDecompressedMB / totalDecompressionTimeSec) * m_maxNumJobs));
 
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             statistics.push_back(Statistic::CreatePercentage(m_name, DecompBoundName, m_decompressionBoundStat.GetAverage()));
@@ -34,8 +34,10 @@ namespace AZ::IO
 
         //! Maximum number of reads that are kept in flight.
         u32 m_maxNumReads{ 2 };
-        //! Maximum number of decompression jobs that can run simultaneously.
-        u32 m_maxNumJobs{ 2 };
+        //! Maximum number of decompression jobs that can run simultaneously. When set to 0 the
+        //! number of jobs is scaled with the number of hardware threads on the machine, so level
+        //! loads on high core count machines aren't capped by the decompression stage.
+        u32 m_maxNumJobs{ 0 };
     };
 
     //! Entry in the streaming stack that decompresses files from an archive that are stored
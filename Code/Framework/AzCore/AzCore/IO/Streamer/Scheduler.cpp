@@ -93,6 +93,17 @@ namespace AZ::IO
         m_context.WakeUpSchedulingThread();
     }
 
+    void Scheduler::QueueRequestBatch(AZStd::span<const FileRequestPtr> requests)
+    {
+        AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
+
+        {
+            AZStd::scoped_lock lock(m_pendingRequestsLock);
+            m_pendingRequests.insert(m_pendingRequests.end(), requests.begin(), requests.end());
+        }
+        m_context.WakeUpSchedulingThread();
+    }
+
     void Scheduler::QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests)
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
@@ -13,6 +13,7 @@
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -37,6 +38,7 @@ namespace AZ::IO
         void QueueRequest(FileRequestPtr request);
         void QueueRequestBatch(const AZStd::vector<FileRequestPtr>& requests);
         void QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests);
+        void QueueRequestBatch(AZStd::span<const FileRequestPtr> requests);
 
         //! Stops the Scheduler's main thread from processing any requests. Requests can still be queued,
         //! but won't be picked up.
@@ -189,6 +189,11 @@ namespace AZ::IO
         m_streamStack->QueueRequestBatch(AZStd::move(requests));
     }
 
+    void Streamer::QueueRequestBatch(AZStd::span<const FileRequestPtr> requests)
+    {
+        m_streamStack->QueueRequestBatch(requests);
+    }
+
     bool Streamer::HasRequestCompleted(FileRequestHandle request) const
     {
         return GetRequestStatus(request) >= IStreamerTypes::RequestStatus::Completed;
@@ -143,6 +143,9 @@ namespace AZ::IO
         //! Queue a batch of requests for processing by Streamer's stack.
         void QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests) override;
 
+        //! Queue a contiguous range of requests for processing by Streamer's stack.
+        void QueueRequestBatch(AZStd::span<const FileRequestPtr> requests) override;
+
         //
         // Streamer request queries
         //
@@ -11,10 +11,13 @@
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/Internal/JobNotify.h>
 
+#include <AzCore/Math/Random.h>
+
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/time.h>
 
 #include <AzCore/Debug/Profiler.h>
 
@@ -30,53 +33,126 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
     return value > job->GetPriority();
 }
 
-void WorkQueue::LocalInsert(Job* job)
+WorkQueue::JobRing::JobRing(size_t capacity)
+    : m_mask(capacity - 1)
+{
+    AZ_Assert((capacity & m_mask) == 0, "JobRing capacity must be a power of two");
+    m_slots = reinterpret_cast<AZStd::atomic<Job*>*>(azmalloc(capacity * sizeof(AZStd::atomic<Job*>), alignof(AZStd::atomic<Job*>)));
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        new (&m_slots[i]) AZStd::atomic<Job*>(nullptr);
+    }
+}
+
+WorkQueue::JobRing::~JobRing()
 {
-    LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
-                                                                                   job->GetPriority(),
-                                                                                   CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    //atomic<Job*> is trivially destructible, freeing the storage is sufficient
+    azfree(m_slots);
 }
 
-Job* WorkQueue::LocalPopFront()
+Job* WorkQueue::JobRing::Load(AZ::s64 index) const
 {
-    LockGuard lock(m_lock);
+    return m_slots[static_cast<size_t>(index) & m_mask].load(AZStd::memory_order_relaxed);
+}
+
+void WorkQueue::JobRing::Store(AZ::s64 index, Job* job)
+{
+    m_slots[static_cast<size_t>(index) & m_mask].store(job, AZStd::memory_order_relaxed);
+}
 
-    Job* result = nullptr;
-    if (!m_queue.empty())
+WorkQueue::WorkQueue()
+{
+    m_ring.store(aznew JobRing(InitialRingCapacity), AZStd::memory_order_relaxed);
+}
+
+WorkQueue::~WorkQueue()
+{
+    delete m_ring.load(AZStd::memory_order_relaxed);
+    for (JobRing* retired : m_retiredRings)
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        delete retired;
     }
+}
 
-    return result;
+void WorkQueue::LocalPush(Job* job)
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+    const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    JobRing* ring = m_ring.load(AZStd::memory_order_relaxed);
+
+    if (bottom - top > static_cast<AZ::s64>(ring->m_mask))
+    {
+        ring = Grow(ring, top, bottom);
+    }
+
+    ring->Store(bottom, job);
+    AZStd::atomic_thread_fence(AZStd::memory_order_release);
+    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
 }
 
-Job* WorkQueue::TryStealFront()
+Job* WorkQueue::LocalPop()
 {
-    AZStd::exponential_backoff backoff;
-    for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+    JobRing* ring = m_ring.load(AZStd::memory_order_relaxed);
+    m_bottom.store(bottom, AZStd::memory_order_relaxed);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+
+    Job* job = nullptr;
+    if (top <= bottom)
     {
-        // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        job = ring->Load(bottom);
+        if (top == bottom)
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
+            //this is the last job in the deque, race any thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                job = nullptr; //a thief got there first
             }
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        //deque was already empty, restore bottom
+        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+    }
+
+    return job;
+}
+
+Job* WorkQueue::TrySteal()
+{
+    AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
 
-            m_lock.unlock();
-            return result;
+    Job* job = nullptr;
+    if (top < bottom)
+    {
+        JobRing* ring = m_ring.load(AZStd::memory_order_acquire);
+        job = ring->Load(top);
+        if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+        {
+            return nullptr; //lost the race to the owner or another thief
         }
+    }
 
-        backoff.wait();
+    return job;
+}
+
+WorkQueue::JobRing* WorkQueue::Grow(JobRing* ring, AZ::s64 top, AZ::s64 bottom)
+{
+    JobRing* grown = aznew JobRing((ring->m_mask + 1) * 2);
+    for (AZ::s64 i = top; i < bottom; ++i)
+    {
+        grown->Store(i, ring->Load(i));
     }
 
-    return nullptr;
+    //thieves may still be reading the old ring, retire it until the queue is destroyed
+    m_retiredRings.push_back(ring);
+    m_ring.store(grown, AZStd::memory_order_release);
+    return grown;
 }
 
 
@@ -145,8 +221,8 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
     }
     else if (info && info->m_isWorker && (info->m_owningManager == this))
     {
-        //current thread is a worker, insert into the local queue based on the job's priority
-        info->m_pendingJobs.LocalInsert(job);
+        //current thread is a worker, push onto the local deque (LIFO order keeps forked jobs cache-warm)
+        info->m_pendingJobs.LocalPush(job);
 #ifdef JOBMANAGER_ENABLE_STATS
         ++info->m_jobsForked;
 #endif
@@ -328,6 +404,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
+
+    //randomized victim selection spreads contention when many workers run out of work at the same time
+    SimpleLcgRandom victimRandom(reinterpret_cast<AZ::u64>(info) ^ static_cast<AZ::u64>(AZStd::GetTimeNowTicks()));
     unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
 
     while (true)
@@ -404,7 +483,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
         if (!job && pendingJobs)
         {
             //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            job = pendingJobs->LocalPop();
         }
 
         bool isTerminated = false;
@@ -434,7 +513,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 //pop a new job from the local queue
                 if (pendingJobs)
                 {
-                    job = pendingJobs->LocalPopFront();
+                    job = pendingJobs->LocalPop();
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
@@ -473,7 +552,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
 
                     //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    job = victimQueue->TrySteal();
                     if (job)
                     {
                         //success, continue with the stolen job
@@ -498,8 +577,8 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         break;
                     }
 
-                    //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
+                    //steal failed, choose a random victim for next time
+                    victim = victimRandom.GetRandom() % m_workerThreads.size();
                     if (m_workerThreads[victim] == info)
                     {
                         //don't steal from ourselves
@@ -13,9 +13,11 @@
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
 
 #include <AzCore/std/containers/queue.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -27,23 +29,49 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Lock-free work-stealing deque (Chase-Lev style, memory ordering following Le et al. 2013).
+         * The owning worker pushes and pops at the bottom in LIFO order, which keeps recently forked
+         * jobs (and their cache lines) hot. Thieves compete for the oldest job at the top, so stolen
+         * work tends to be the largest remaining subtree of a parallel decomposition.
+         */
         class WorkQueue final
         {
         public:
-            void LocalInsert(Job *job);
-            Job* LocalPopFront();
-            Job* TryStealFront();
+            WorkQueue();
+            ~WorkQueue();
+
+            //! Pushes a job onto the owner's end of the deque. Must only be called from the owning worker thread.
+            void LocalPush(Job* job);
+            //! Pops the most recently pushed job. Must only be called from the owning worker thread.
+            Job* LocalPop();
+            //! Attempts to steal the oldest job in the deque. Safe to call from any thread, returns nullptr on conflict or empty.
+            Job* TrySteal();
 
         private:
-            enum
+            //! Circular array of job pointers, capacity is always a power of two.
+            struct JobRing
             {
-                TryStealSpinAttemps = 16,
+                AZ_CLASS_ALLOCATOR(JobRing, SystemAllocator, 0)
+
+                explicit JobRing(size_t capacity);
+                ~JobRing();
+
+                Job* Load(AZ::s64 index) const;
+                void Store(AZ::s64 index, Job* job);
+
+                size_t m_mask;
+                AZStd::atomic<Job*>* m_slots;
             };
-            using LockType = AZStd::shared_mutex;
-            using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
-            LockType m_lock;
+            static constexpr size_t InitialRingCapacity = 256;
+
+            JobRing* Grow(JobRing* ring, AZ::s64 top, AZ::s64 bottom);
+
+            AZStd::atomic<AZ::s64> m_top{ 0 };
+            AZStd::atomic<AZ::s64> m_bottom{ 0 };
+            AZStd::atomic<JobRing*> m_ring{ nullptr };
+            AZStd::vector<JobRing*> m_retiredRings; //only mutated by the owner thread, freed on destruction as thieves may still be reading old rings
         };
 
         /**
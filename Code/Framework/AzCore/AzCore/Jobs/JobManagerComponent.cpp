@@ -25,6 +25,7 @@
 AZ_CVAR(float, cl_jobThreadsConcurrencyRatio, 0.6f, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system multiplier on the number of hw threads the machine creates at initialization");
 AZ_CVAR(uint32_t, cl_jobThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system number of hardware threads that are reserved for O3DE system threads");
 AZ_CVAR(uint32_t, cl_jobThreadsMinNumber, 3, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system minimum number of worker threads to create after scaling the number of hw threads");
+AZ_CVAR(int32_t, cl_jobThreadsFirstCpuId, -1, nullptr, AZ::ConsoleFunctorFlags::Null, "When 0 or greater, pins each legacy Job system worker thread to a single core starting at this CPU id; -1 leaves workers unpinned");
 
 namespace AZ
 {
@@ -65,9 +66,11 @@ namespace AZ
         #endif // (AZ_TRAIT_THREAD_NUM_JOB_MANAGER_WORKER_THREADS)
         }
 
-        threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
+        int firstThreadCpu = (m_firstThreadCPU >= 0) ? m_firstThreadCPU : static_cast<int>(cl_jobThreadsFirstCpuId);
         for (int i = 0; i < numberOfWorkerThreads; ++i)
         {
+            //pin each worker to its own core when a first CPU id was provided, otherwise let the scheduler place them
+            threadDesc.m_cpuId = (firstThreadCpu >= 0) ? (1 << (firstThreadCpu + i)) : AFFINITY_MASK_USERTHREADS;
             desc.m_workerThreads.push_back(threadDesc);
         }
 
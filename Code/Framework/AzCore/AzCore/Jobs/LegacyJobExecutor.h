@@ -12,6 +12,7 @@
 
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/condition_variable.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -39,6 +40,28 @@ namespace AZ
             StartJobInternal(job);
         }
 
+        // Migration path to the TaskGraph system: runs the work on the TaskExecutor instead of the
+        // legacy JobManager, while still participating in this executor's completion accounting, so
+        // call sites can be ported one at a time and WaitForCompletion/SetPostJob keep working across
+        // a mix of StartJob and StartTask calls. Note that the function's captures must fit in the
+        // Task inline buffer (see AZ::Internal::Task), capture a pointer to larger state instead.
+        template <class Function>
+        inline void StartTask(TaskDescriptor const& descriptor, const Function& processFunction)
+        {
+            IncJobCount();
+
+            TaskGraph taskGraph;
+            taskGraph.AddTask(
+                descriptor,
+                [this, processFunction]()
+                {
+                    processFunction();
+                    JobCompleteUpdate();
+                });
+            taskGraph.Detach();
+            taskGraph.Submit();
+        }
+
         // SetPostJob - This API exists to support backwards compatibility and is not a recommended pattern to be copied.
         //  Instead, create AZ::Jobs with appropriate dependencies on each other
         template <class Function>
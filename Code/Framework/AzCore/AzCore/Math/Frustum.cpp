@@ -192,6 +192,100 @@ namespace AZ
     }
 
 
+    void Frustum::IntersectAabbBatch(AZStd::span<const Aabb> aabbs, AZStd::span<IntersectResult> results) const
+    {
+        using Simd::Vec4;
+
+        AZ_Assert(results.size() >= aabbs.size(), "Frustum::IntersectAabbBatch - the results span is smaller than the aabb span.");
+
+        // Splat the plane equations into structure-of-arrays registers once, one register per
+        // plane component, so four boxes run through each plane test together. The absolute
+        // normals give the projection radius of a box onto the plane normal.
+        Vec4::FloatType planeX[PlaneId::MAX];
+        Vec4::FloatType planeY[PlaneId::MAX];
+        Vec4::FloatType planeZ[PlaneId::MAX];
+        Vec4::FloatType planeW[PlaneId::MAX];
+        Vec4::FloatType absPlaneX[PlaneId::MAX];
+        Vec4::FloatType absPlaneY[PlaneId::MAX];
+        Vec4::FloatType absPlaneZ[PlaneId::MAX];
+        for (PlaneId planeId = PlaneId::Near; planeId < PlaneId::MAX; ++planeId)
+        {
+            planeX[planeId] = Vec4::SplatFirst(m_planes[planeId]);
+            planeY[planeId] = Vec4::SplatSecond(m_planes[planeId]);
+            planeZ[planeId] = Vec4::SplatThird(m_planes[planeId]);
+            planeW[planeId] = Vec4::SplatFourth(m_planes[planeId]);
+            absPlaneX[planeId] = Vec4::Abs(planeX[planeId]);
+            absPlaneY[planeId] = Vec4::Abs(planeY[planeId]);
+            absPlaneZ[planeId] = Vec4::Abs(planeZ[planeId]);
+        }
+
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType allOnes = Vec4::CmpEq(zero, zero);
+
+        const size_t simdCount = aabbs.size() & ~size_t(3);
+        for (size_t i = 0; i < simdCount; i += 4)
+        {
+            // gather four boxes as center/extents pairs and transpose them into lanes
+            Vec4::FloatType centers[4];
+            Vec4::FloatType extents[4];
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                const Vec4::FloatType minimum = Vec4::FromVec3(aabbs[i + lane].GetMin().GetSimdValue());
+                const Vec4::FloatType maximum = Vec4::FromVec3(aabbs[i + lane].GetMax().GetSimdValue());
+                centers[lane] = Vec4::Mul(Vec4::Add(maximum, minimum), half);
+                extents[lane] = Vec4::Mul(Vec4::Sub(maximum, minimum), half);
+            }
+            Vec4::FloatType centersSoa[4]; // centersSoa[0] holds the four x values, etc.
+            Vec4::FloatType extentsSoa[4];
+            Vec4::Mat4x4Transpose(centers, centersSoa);
+            Vec4::Mat4x4Transpose(extents, extentsSoa);
+
+            // bounding sphere radii, used to reject whole blocks with a single compare
+            const Vec4::FloatType radius = Vec4::Sqrt(Vec4::Madd(extentsSoa[0], extentsSoa[0],
+                Vec4::Madd(extentsSoa[1], extentsSoa[1], Vec4::Mul(extentsSoa[2], extentsSoa[2]))));
+
+            Vec4::FloatType exteriorMask = zero;
+            Vec4::FloatType interiorMask = allOnes;
+            for (PlaneId planeId = PlaneId::Near; planeId < PlaneId::MAX; ++planeId)
+            {
+                const Vec4::FloatType distance = Vec4::Madd(planeX[planeId], centersSoa[0],
+                    Vec4::Madd(planeY[planeId], centersSoa[1],
+                        Vec4::Madd(planeZ[planeId], centersSoa[2], planeW[planeId])));
+
+                // sphere pretest: all four bounding spheres behind this plane rejects the block
+                if (Vec4::CmpAllLt(distance, Vec4::Sub(zero, radius)))
+                {
+                    exteriorMask = allOnes;
+                    break;
+                }
+
+                const Vec4::FloatType projectedRadius = Vec4::Madd(absPlaneX[planeId], extentsSoa[0],
+                    Vec4::Madd(absPlaneY[planeId], extentsSoa[1],
+                        Vec4::Mul(absPlaneZ[planeId], extentsSoa[2])));
+
+                exteriorMask = Vec4::Or(exteriorMask, Vec4::CmpLt(distance, Vec4::Sub(zero, projectedRadius)));
+                interiorMask = Vec4::And(interiorMask, Vec4::CmpGtEq(distance, projectedRadius));
+            }
+
+            int32_t exteriorBits[4];
+            int32_t interiorBits[4];
+            Vec4::StoreUnaligned(exteriorBits, Vec4::CastToInt(exteriorMask));
+            Vec4::StoreUnaligned(interiorBits, Vec4::CastToInt(interiorMask));
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                results[i + lane] = exteriorBits[lane] ? IntersectResult::Exterior
+                    : (interiorBits[lane] ? IntersectResult::Interior : IntersectResult::Overlaps);
+            }
+        }
+
+        for (size_t i = simdCount; i < aabbs.size(); ++i)
+        {
+            results[i] = IntersectAabb(aabbs[i]);
+        }
+    }
+
+
     ViewFrustumAttributes Frustum::CalculateViewFrustumAttributes() const
     {
         using Simd::Vec4;
@@ -15,6 +15,7 @@
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ
 {
@@ -142,6 +143,16 @@ namespace AZ
         //! @return the intersection result of the Aabb against the frustum
         IntersectResult IntersectAabb(const Aabb& aabb) const;
 
+        //! Intersects an array of axis-aligned bounding boxes against the frustum.
+        //! Tests four boxes per iteration by splatting the plane equations into
+        //! structure-of-arrays registers, with a bounding sphere pretest that rejects whole
+        //! blocks early, so large culling passes are considerably cheaper than calling
+        //! IntersectAabb per box.
+        //!
+        //! @param aabbs the bounding boxes to test against
+        //! @param results receives the intersection result for each box, has to hold at least as many entries as aabbs
+        void IntersectAabbBatch(AZStd::span<const Aabb> aabbs, AZStd::span<IntersectResult> results) const;
+
         //! Returns true if the current frustum and provided frustum are close to identical.
         //! @param rhs the frustum to compare against for closeness
         bool IsClose(const Frustum& rhs, float tolerance = Constants::Tolerance) const;
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/TransformBatch.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace AZ
+{
+    namespace TransformBatch
+    {
+        void MultiplyArray(const Transform* lhs, const Transform* rhs, Transform* result, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                result[i] = lhs[i] * rhs[i];
+            }
+        }
+
+        void MultiplyArray(const Transform& parent, const Transform* rhs, Transform* result, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                result[i] = parent * rhs[i];
+            }
+        }
+
+        void InverseArray(const Transform* input, Transform* result, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                result[i] = input[i].GetInverse();
+            }
+        }
+
+        void TransformPointArray(const Transform& transform, const Vector3* points, Vector3* result, size_t count)
+        {
+            const Matrix3x4 matrix = Matrix3x4::CreateFromTransform(transform);
+            for (size_t i = 0; i < count; ++i)
+            {
+                result[i] = matrix.TransformPoint(points[i]);
+            }
+        }
+
+        void TransformPointArraySoa(const Transform& transform,
+            const float* x, const float* y, const float* z,
+            float* resultX, float* resultY, float* resultZ, size_t count)
+        {
+            const Matrix3x4 matrix = Matrix3x4::CreateFromTransform(transform);
+
+            // splat each matrix element across a register so four points go through the
+            // matrix multiply together
+            const Simd::Vec4::FloatType m00 = Simd::Vec4::Splat(matrix.GetElement(0, 0));
+            const Simd::Vec4::FloatType m01 = Simd::Vec4::Splat(matrix.GetElement(0, 1));
+            const Simd::Vec4::FloatType m02 = Simd::Vec4::Splat(matrix.GetElement(0, 2));
+            const Simd::Vec4::FloatType m03 = Simd::Vec4::Splat(matrix.GetElement(0, 3));
+            const Simd::Vec4::FloatType m10 = Simd::Vec4::Splat(matrix.GetElement(1, 0));
+            const Simd::Vec4::FloatType m11 = Simd::Vec4::Splat(matrix.GetElement(1, 1));
+            const Simd::Vec4::FloatType m12 = Simd::Vec4::Splat(matrix.GetElement(1, 2));
+            const Simd::Vec4::FloatType m13 = Simd::Vec4::Splat(matrix.GetElement(1, 3));
+            const Simd::Vec4::FloatType m20 = Simd::Vec4::Splat(matrix.GetElement(2, 0));
+            const Simd::Vec4::FloatType m21 = Simd::Vec4::Splat(matrix.GetElement(2, 1));
+            const Simd::Vec4::FloatType m22 = Simd::Vec4::Splat(matrix.GetElement(2, 2));
+            const Simd::Vec4::FloatType m23 = Simd::Vec4::Splat(matrix.GetElement(2, 3));
+
+            const size_t simdCount = count & ~size_t(3);
+            for (size_t i = 0; i < simdCount; i += 4)
+            {
+                const Simd::Vec4::FloatType px = Simd::Vec4::LoadUnaligned(x + i);
+                const Simd::Vec4::FloatType py = Simd::Vec4::LoadUnaligned(y + i);
+                const Simd::Vec4::FloatType pz = Simd::Vec4::LoadUnaligned(z + i);
+
+                const Simd::Vec4::FloatType rx = Simd::Vec4::Madd(px, m00, Simd::Vec4::Madd(py, m01, Simd::Vec4::Madd(pz, m02, m03)));
+                const Simd::Vec4::FloatType ry = Simd::Vec4::Madd(px, m10, Simd::Vec4::Madd(py, m11, Simd::Vec4::Madd(pz, m12, m13)));
+                const Simd::Vec4::FloatType rz = Simd::Vec4::Madd(px, m20, Simd::Vec4::Madd(py, m21, Simd::Vec4::Madd(pz, m22, m23)));
+
+                Simd::Vec4::StoreUnaligned(resultX + i, rx);
+                Simd::Vec4::StoreUnaligned(resultY + i, ry);
+                Simd::Vec4::StoreUnaligned(resultZ + i, rz);
+            }
+
+            for (size_t i = simdCount; i < count; ++i)
+            {
+                const Vector3 point = matrix.TransformPoint(Vector3(x[i], y[i], z[i]));
+                resultX[i] = point.GetX();
+                resultY[i] = point.GetY();
+                resultZ[i] = point.GetZ();
+            }
+        }
+    }
+}
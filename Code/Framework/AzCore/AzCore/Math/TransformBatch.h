@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+
+namespace AZ
+{
+    //! Batch kernels for bulk transform work such as pose blending and instance placement.
+    //! Working on whole arrays keeps per-element conversions (quaternion to matrix) out of
+    //! the inner loop and lets the Simd::Vec4 based math pipeline across elements, which the
+    //! single-transform API in Transform.h can't do.
+    //! All functions accept result arrays that alias their input arrays for in-place use.
+    namespace TransformBatch
+    {
+        //! Multiplies pairs of transforms, result[i] = lhs[i] * rhs[i].
+        void MultiplyArray(const Transform* lhs, const Transform* rhs, Transform* result, size_t count);
+
+        //! Multiplies an array of transforms by a fixed parent, result[i] = parent * rhs[i].
+        //! Useful to bring an array of local space transforms into world space.
+        void MultiplyArray(const Transform& parent, const Transform* rhs, Transform* result, size_t count);
+
+        //! Inverts an array of transforms, result[i] = input[i].GetInverse().
+        void InverseArray(const Transform* input, Transform* result, size_t count);
+
+        //! Transforms an array of points by a single transform. The rotation is converted to a
+        //! matrix once, so this is considerably cheaper than calling TransformPoint per point.
+        void TransformPointArray(const Transform& transform, const Vector3* points, Vector3* result, size_t count);
+
+        //! Transforms points stored in structure-of-arrays layout (separate, densely packed x/y/z
+        //! streams), processing four points per iteration with Simd::Vec4. Preferred over
+        //! TransformPointArray when the data is already SoA packed. The streams don't need
+        //! to be aligned.
+        void TransformPointArraySoa(const Transform& transform,
+            const float* x, const float* y, const float* z,
+            float* resultX, float* resultY, float* resultZ, size_t count);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/OSAllocator_Platform.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+
+namespace AZ
+{
+    namespace
+    {
+        //! Capacity used by arenas that haven't been created yet. Written during boot before
+        //! the worker threads that use the allocator are running, so a plain variable is enough.
+        size_t s_defaultArenaCapacity = FrameAllocator::DefaultArenaCapacity;
+    }
+
+    struct FrameAllocator::ThreadArena
+    {
+        //! Header prepended to allocations that didn't fit in the arena and went to the OS
+        //! heap instead. The headers form a stack so a rewind can free everything past a mark.
+        struct OverflowHeader
+        {
+            OverflowHeader* m_next;
+        };
+
+        ~ThreadArena()
+        {
+            FreeOverflowUntil(nullptr);
+            if (m_begin)
+            {
+                AZ_OS_FREE(m_begin);
+            }
+        }
+
+        void FreeOverflowUntil(OverflowHeader* overflowHead)
+        {
+            while (m_overflowHead != overflowHead)
+            {
+                OverflowHeader* next = m_overflowHead->m_next;
+                AZ_OS_FREE(m_overflowHead);
+                m_overflowHead = next;
+            }
+        }
+
+        u8* m_begin{ nullptr };
+        size_t m_capacity{ 0 };
+        size_t m_offset{ 0 };
+        size_t m_peakOffset{ 0 };
+        OverflowHeader* m_overflowHead{ nullptr };
+        bool m_warnedOverflow{ false };
+    };
+
+    auto FrameAllocator::GetThreadArena() -> ThreadArena&
+    {
+        thread_local ThreadArena arena;
+        return arena;
+    }
+
+    void* FrameAllocator::Allocate(size_t byteSize, size_t alignment)
+    {
+        AZ_Assert(alignment > 0 && (alignment & (alignment - 1)) == 0,
+            "FrameAllocator::Allocate - alignment has to be a power of two.");
+
+        ThreadArena& arena = GetThreadArena();
+        if (!arena.m_begin)
+        {
+            arena.m_capacity = s_defaultArenaCapacity;
+            arena.m_begin = reinterpret_cast<u8*>(AZ_OS_MALLOC(arena.m_capacity, AZCORE_GLOBAL_NEW_ALIGNMENT));
+        }
+
+        size_t alignedOffset = SizeAlignUp(arena.m_offset, alignment);
+        if (alignedOffset + byteSize <= arena.m_capacity)
+        {
+            arena.m_offset = alignedOffset + byteSize;
+            arena.m_peakOffset = AZStd::max(arena.m_peakOffset, arena.m_offset);
+            return arena.m_begin + alignedOffset;
+        }
+
+        // The arena is exhausted, hand the allocation to the OS heap with a header so the
+        // covering rewind can free it. Correct but slow, so worth a one-time warning.
+        if (!arena.m_warnedOverflow)
+        {
+            arena.m_warnedOverflow = true;
+            AZ_Warning("Memory", false, "FrameAllocator arena of %zu bytes is exhausted (request of %zu bytes); "
+                "falling back to the OS heap. Increase the capacity through SetDefaultArenaCapacity.",
+                arena.m_capacity, byteSize);
+        }
+
+        alignment = AZStd::max(alignment, AZStd::alignment_of<ThreadArena::OverflowHeader>::value);
+        size_t headerSize = SizeAlignUp(sizeof(ThreadArena::OverflowHeader), alignment);
+        u8* block = reinterpret_cast<u8*>(AZ_OS_MALLOC(headerSize + byteSize, alignment));
+        auto* header = reinterpret_cast<ThreadArena::OverflowHeader*>(block);
+        header->m_next = arena.m_overflowHead;
+        arena.m_overflowHead = header;
+        return block + headerSize;
+    }
+
+    auto FrameAllocator::CaptureMark() -> Mark
+    {
+        ThreadArena& arena = GetThreadArena();
+        Mark mark;
+        mark.m_offset = arena.m_offset;
+        mark.m_overflowHead = arena.m_overflowHead;
+        return mark;
+    }
+
+    void FrameAllocator::Rewind(const Mark& mark)
+    {
+        ThreadArena& arena = GetThreadArena();
+        AZ_Assert(mark.m_offset <= arena.m_offset,
+            "FrameAllocator::Rewind - mark is ahead of the arena; marks have to be rewound in LIFO order "
+            "on the thread that captured them.");
+        arena.m_offset = mark.m_offset;
+        arena.FreeOverflowUntil(reinterpret_cast<ThreadArena::OverflowHeader*>(mark.m_overflowHead));
+    }
+
+    void FrameAllocator::Reset()
+    {
+        ThreadArena& arena = GetThreadArena();
+        arena.m_offset = 0;
+        arena.FreeOverflowUntil(nullptr);
+    }
+
+    size_t FrameAllocator::GetAllocatedSize()
+    {
+        return GetThreadArena().m_offset;
+    }
+
+    size_t FrameAllocator::GetPeakAllocatedSize()
+    {
+        return GetThreadArena().m_peakOffset;
+    }
+
+    void FrameAllocator::SetDefaultArenaCapacity(size_t capacityInBytes)
+    {
+        AZ_Assert(capacityInBytes > 0, "FrameAllocator::SetDefaultArenaCapacity - capacity has to be larger than 0.");
+        s_defaultArenaCapacity = capacityInBytes;
+    }
+}
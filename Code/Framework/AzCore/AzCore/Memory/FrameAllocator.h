@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/base.h>
+#include <AzCore/std/typetraits/integral_constant.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+
+namespace AZ
+{
+    /**
+     * Linear (bump pointer) allocator for short-lived, per-frame memory such as culling
+     * lists and draw packet staging buffers. Every thread gets its own arena so the hot
+     * path is a pointer bump with no synchronization and no per-allocation bookkeeping.
+     *
+     * Individual frees are no-ops; memory is reclaimed in bulk by rewinding the calling
+     * thread's arena to a previously captured mark (see ScopedArenaMark) or by calling
+     * Reset at a known safe point such as the end of the frame. Marks must be rewound in
+     * LIFO order on the thread that captured them.
+     *
+     * Allocations that don't fit in the remaining arena space fall back to the OS heap
+     * and are released by the rewind or reset that covers them, so oversized requests
+     * degrade in speed rather than fail.
+     */
+    class FrameAllocator
+    {
+    public:
+        //! Position in the calling thread's arena, captured by CaptureMark and restored by Rewind.
+        struct Mark
+        {
+            size_t m_offset{ 0 };
+            void* m_overflowHead{ nullptr };
+        };
+
+        //! Arena size used for a thread's first allocation unless SetDefaultArenaCapacity was called earlier.
+        static constexpr size_t DefaultArenaCapacity = 2 * 1024 * 1024;
+
+        //! Allocates memory from the calling thread's arena. The alignment has to be a power of two.
+        static void* Allocate(size_t byteSize, size_t alignment);
+
+        //! Captures the current position of the calling thread's arena.
+        static Mark CaptureMark();
+
+        //! Rewinds the calling thread's arena to a mark captured earlier on the same thread,
+        //! releasing everything allocated since, including any OS heap overflow allocations.
+        static void Rewind(const Mark& mark);
+
+        //! Rewinds the calling thread's arena to its start. Call at a point where no frame
+        //! allocations from this thread are referenced anymore, typically the end of the frame.
+        static void Reset();
+
+        //! Returns the number of bytes currently allocated from the calling thread's arena.
+        //! Overflow allocations that were handed to the OS heap are not included.
+        static size_t GetAllocatedSize();
+
+        //! Returns the high watermark of the calling thread's arena, useful to tune the capacity.
+        static size_t GetPeakAllocatedSize();
+
+        //! Sets the arena capacity used by threads that haven't allocated yet. Call during boot
+        //! before worker threads start using the allocator; existing arenas are not resized.
+        static void SetDefaultArenaCapacity(size_t capacityInBytes);
+
+    private:
+        struct ThreadArena;
+        static ThreadArena& GetThreadArena();
+    };
+
+    /**
+     * Captures the calling thread's frame arena position on construction and rewinds to it on
+     * destruction. Scopes have to nest and the object can't be moved across threads.
+     * How to use:
+     * void CullVisibleObjects()
+     * {
+     *     ScopedArenaMark frameScope;
+     *     AZStd::vector<CullingEntry, AZ::FrameStdAllocator> entries; // freed when frameScope ends
+     *     ...
+     * }
+     */
+    class ScopedArenaMark
+    {
+    public:
+        ScopedArenaMark()
+            : m_mark(FrameAllocator::CaptureMark()) {}
+        ~ScopedArenaMark()
+        {
+            FrameAllocator::Rewind(m_mark);
+        }
+
+    private:
+        ScopedArenaMark(const ScopedArenaMark&) = delete;
+        ScopedArenaMark& operator=(const ScopedArenaMark&) = delete;
+
+        FrameAllocator::Mark m_mark;
+    };
+
+    /**
+     * AZStd allocator adapter for FrameAllocator, for containers holding frame temporaries.
+     * deallocate is a no-op (allow_memory_leaks lets containers skip it entirely); the memory
+     * is reclaimed by the enclosing ScopedArenaMark or the frame Reset, so containers using
+     * this allocator must not outlive either.
+     */
+    class FrameStdAllocator
+    {
+    public:
+        AZ_TYPE_INFO(FrameStdAllocator, "{3F2A5D8C-91E4-4E24-BD0A-7C64E1A9F3D2}");
+
+        typedef void*               pointer_type;
+        typedef AZStd::size_t       size_type;
+        typedef AZStd::ptrdiff_t    difference_type;
+        typedef AZStd::true_type    allow_memory_leaks;
+
+        AZ_FORCE_INLINE FrameStdAllocator(const char* name = "AZ::FrameStdAllocator")
+            : m_name(name) {}
+        AZ_FORCE_INLINE FrameStdAllocator(const FrameStdAllocator& rhs)
+            : m_name(rhs.m_name) {}
+        AZ_FORCE_INLINE FrameStdAllocator(const FrameStdAllocator& rhs, const char* name)
+            : m_name(name) { (void)rhs; }
+
+        AZ_FORCE_INLINE FrameStdAllocator& operator=(const FrameStdAllocator& rhs) { m_name = rhs.m_name; return *this; }
+
+        AZ_FORCE_INLINE const char* get_name() const { return m_name; }
+        AZ_FORCE_INLINE void set_name(const char* name) { m_name = name; }
+
+        AZ_FORCE_INLINE pointer_type allocate(size_type byteSize, size_type alignment, int flags = 0)
+        {
+            (void)flags;
+            return FrameAllocator::Allocate(byteSize, alignment);
+        }
+        AZ_FORCE_INLINE void deallocate(pointer_type ptr, size_type byteSize, size_type alignment)
+        {
+            // reclaimed in bulk by rewinding the arena
+            (void)ptr;
+            (void)byteSize;
+            (void)alignment;
+        }
+        AZ_FORCE_INLINE size_type resize(pointer_type ptr, size_type newSize)
+        {
+            (void)ptr;
+            (void)newSize;
+            return 0;
+        }
+
+        AZ_FORCE_INLINE size_type max_size() const { return FrameAllocator::DefaultArenaCapacity; }
+        AZ_FORCE_INLINE size_type get_allocated_size() const { return FrameAllocator::GetAllocatedSize(); }
+
+    private:
+        const char* m_name;
+    };
+
+    AZ_FORCE_INLINE bool operator==(const FrameStdAllocator& a, const FrameStdAllocator& b)
+    {
+        (void)a;
+        (void)b;
+        return true;
+    }
+
+    AZ_FORCE_INLINE bool operator!=(const FrameStdAllocator& a, const FrameStdAllocator& b)
+    {
+        (void)a;
+        (void)b;
+        return false;
+    }
+}
@@ -87,33 +87,47 @@ namespace AZ
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (const Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
-
-            if (useCount == 0)
+            for (const auto& keyValue : shard.m_dictionary)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
-            }
-            else
-            {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash % ShardCount];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash % ShardCount];
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
         {
             return Name(iter->second);
         }
@@ -128,9 +142,18 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        // Null strings should return empty.
+        if (nameString.empty())
+        {
+            return Name();
+        }
 
-        // If we find the same name with the same hash, just return it. 
+        // If we find the same name with the same hash, just return it.
         // This path is faster than the loop below because FindName() takes a shared_lock whereas the
         // loop requires a unique_lock to modify the dictionary.
         Name name = FindName(hash);
@@ -139,19 +162,24 @@ namespace AZ
             return AZStd::move(name);
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
+        // The name doesn't exist in the dictionary, so we have to lock the owning shard and add it
         bool collisionDetected = false;
         while (true)
         {
+            // Each probe may land in a different shard, so the write lock is re-acquired per hash value.
+            // Collided entries are never removed from the dictionary (see TryReleaseName), so the probe
+            // chain stays intact between lock acquisitions.
+            Shard& shard = GetShard(hash);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_mutex);
+
+            auto iter = shard.m_dictionary.find(hash);
+
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_dictionary.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                shard.m_dictionary.emplace(hash, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -165,7 +193,6 @@ namespace AZ
                 collisionDetected = true;
                 iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -184,10 +211,11 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        Shard& shard = GetShard(hash);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_mutex);
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        auto dictIt = shard.m_dictionary.find(hash);
+        if (dictIt == shard.m_dictionary.end())
         {
             // This check is to safeguard around the following scenario
             // T1, gets into TryReleaseName
@@ -200,7 +228,7 @@ namespace AZ
 
         Internal::NameData* nameData = dictIt->second;
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
+        // Check m_hashCollision inside the shard mutex because a new collision could have happened
         // on another thread before taking the lock.
         if (nameData->m_hashCollision)
         {
@@ -214,7 +242,7 @@ namespace AZ
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
+            shard.m_dictionary.erase(nameData->GetHash());
             delete nameData;
         }
 
@@ -227,6 +255,8 @@ namespace AZ
 
         // At some point it would be nice to formalize this stats output to be activated on demand by a runtime
         // feature, like a CVAR. But for now we can just activate it by breaking in the debugger.
+        // Note that this walks every shard without taking the shard locks; it is debugger-activated
+        // diagnostics only, and taking all shard locks here could deadlock against the caller's shard lock.
         static bool reportUsage = false;
         if (reportUsage)
         {
@@ -235,35 +265,41 @@ namespace AZ
 
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
+            size_t nameCount = 0;
 
-            for (auto& iter : m_dictionary)
+            for (const Shard& dictShard : m_shards)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                nameCount += dictShard.m_dictionary.size();
 
-                if (!longestName || longestName->m_name.size() < nameLength)
+                for (auto& iter : dictShard.m_dictionary)
                 {
-                    longestName = iter.second;
-                }
+                    const size_t nameLength = iter.second->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = iter.second;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = iter.second;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = iter.second;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = iter.second;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -285,12 +321,4 @@ namespace AZ
 
 #endif // AZ_DEBUG_BUILD
     }
-
-    Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
-    {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
-    }
 }
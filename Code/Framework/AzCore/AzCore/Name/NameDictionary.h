@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/typetraits/integral_constant.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -72,11 +74,30 @@ namespace AZ
         //! @return A Name instance holding a dictionary entry associated with the provided raw string.
         Name MakeName(AZStd::string_view name);
 
+        //! Makes a Name from a raw string whose hash was already calculated by CalcHash, typically at
+        //! compile time through AZ_NAME_LITERAL. Collision resolution and string sharing behave exactly
+        //! like MakeName(name), only the runtime string hash is skipped.
+        //!
+        //! @param name The name to resolve against the dictionary.
+        //! @param nameHash The value of CalcHash(name).
+        //! @return A Name instance holding a dictionary entry associated with the provided raw string.
+        Name MakeName(AZStd::string_view name, Name::Hash nameHash);
+
         //! Search for an existing name in the dictionary by hash.
         //! @param hash The key by which to search for the name.
         //! @return A Name instance. If the hash was not found, the Name will be empty.
         Name FindName(Name::Hash hash) const;
 
+        //! Calculates a hash for the provided name string.
+        //! Does not attempt to resolve hash collisions; that is handled elsewhere.
+        //! This is constexpr so string literals can be hashed at compile time (see AZ_NAME_LITERAL).
+        static constexpr Name::Hash CalcHash(AZStd::string_view name)
+        {
+            // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            // of network synchronization. So just take the low 32 bits.
+            return static_cast<Name::Hash>(AZStd::hash<AZStd::string_view>{}(name) & 0xFFFFFFFF);
+        }
+
         NameDictionary();
     private:
         ~NameDictionary();
@@ -92,11 +113,27 @@ namespace AZ
 
         //////////////////////////////////////////////////////////////////////////
 
-        // Calculates a hash for the provided name string.
-        // Does not attempt to resolve hash collisions; that is handled elsewhere.
-        Name::Hash CalcHash(AZStd::string_view name);
+        // The dictionary is sharded by hash so that concurrent Name creation from different threads
+        // contends on a fraction of the map rather than a single global lock. Each shard pairs its
+        // slice of the dictionary with its own shared_mutex; operations never hold more than one
+        // shard lock at a time.
+        static constexpr size_t ShardCount = 16;
+
+        struct Shard
+        {
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+            mutable AZStd::shared_mutex m_mutex;
+        };
 
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        AZStd::array<Shard, ShardCount> m_shards;
     };
 }
+
+//! Creates an AZ::Name from a string literal, with the dictionary hash computed at compile time.
+//! The literal still resolves against the NameDictionary on first use, so collision handling and
+//! string sharing behave exactly like AZ::Name(const char*); only the runtime string hash is skipped.
+#define AZ_NAME_LITERAL(str)                                                                                                               \
+    AZ::NameDictionary::Instance().MakeName(str, AZStd::integral_constant<AZ::Name::Hash, AZ::NameDictionary::CalcHash(str)>::value)
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/BakedObjectFormat.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/RTTI/AttributeReader.h>
+#include <AzCore/Debug/Trace.h>
+
+namespace AZ
+{
+    namespace
+    {
+        constexpr uint64_t BakedPayloadAlignment = 16;
+
+        constexpr uint64_t AlignUp(uint64_t value, uint64_t alignment)
+        {
+            return (value + (alignment - 1)) & ~(alignment - 1);
+        }
+
+        //! The payload begins at the first aligned offset past the header and relocation table.
+        constexpr uint64_t GetPayloadFileOffset(uint64_t relocationCount)
+        {
+            return AlignUp(sizeof(BakedObjectHeader) + (relocationCount * sizeof(BakedObjectRelocation)), BakedPayloadAlignment);
+        }
+    }
+
+    BakedObjectWriter::BakedObjectWriter(const Uuid& classId, uint32_t classLayoutVersion)
+        : m_classId(classId)
+        , m_classLayoutVersion(classLayoutVersion)
+    {
+        ;
+    }
+
+    uint64_t BakedObjectWriter::AppendBytes(const void* data, uint64_t size, uint64_t alignment)
+    {
+        const uint64_t alignedOffset = AlignUp(m_payload.size(), alignment);
+        m_payload.resize(alignedOffset + size);
+        memcpy(m_payload.data() + alignedOffset, data, size);
+        return alignedOffset;
+    }
+
+    void BakedObjectWriter::AddRelocation(uint64_t pointerOffset, uint64_t targetOffset)
+    {
+        AZ_Assert(pointerOffset + sizeof(uint64_t) <= m_payload.size(), "Relocation pointer lies outside the baked payload");
+        AZ_Assert(targetOffset <= m_payload.size(), "Relocation target lies outside the baked payload");
+        m_relocations.push_back(BakedObjectRelocation{ pointerOffset, targetOffset });
+    }
+
+    bool BakedObjectWriter::Write(IO::GenericStream& stream) const
+    {
+        BakedObjectHeader header;
+        header.m_classId = m_classId;
+        header.m_classLayoutVersion = m_classLayoutVersion;
+        header.m_relocationCount = static_cast<uint32_t>(m_relocations.size());
+        header.m_payloadSize = m_payload.size();
+
+        if (stream.Write(sizeof(header), &header) != sizeof(header))
+        {
+            return false;
+        }
+
+        const uint64_t relocationBytes = m_relocations.size() * sizeof(BakedObjectRelocation);
+        if ((relocationBytes > 0) && (stream.Write(relocationBytes, m_relocations.data()) != relocationBytes))
+        {
+            return false;
+        }
+
+        // Pad so the payload lands on an aligned file offset, allowing aligned in-place access when mapped
+        const uint64_t payloadOffset = GetPayloadFileOffset(m_relocations.size());
+        const uint64_t paddingBytes = payloadOffset - (sizeof(header) + relocationBytes);
+        const uint8_t padding[BakedPayloadAlignment] = { 0 };
+        if ((paddingBytes > 0) && (stream.Write(paddingBytes, padding) != paddingBytes))
+        {
+            return false;
+        }
+
+        return stream.Write(m_payload.size(), m_payload.data()) == m_payload.size();
+    }
+
+    namespace BakedObjectLoader
+    {
+        void* PatchInPlace(void* buffer, uint64_t bufferSize, const Uuid& expectedClassId, uint32_t expectedClassLayoutVersion)
+        {
+            if (bufferSize < sizeof(BakedObjectHeader))
+            {
+                AZ_Error("BakedObjectFormat", false, "Image is smaller than the format header");
+                return nullptr;
+            }
+
+            BakedObjectHeader header;
+            memcpy(&header, buffer, sizeof(header));
+
+            if (header.m_magic != BakedObjectHeader::BakedObjectMagic)
+            {
+                AZ_Error("BakedObjectFormat", false, "Image does not carry the baked object magic value");
+                return nullptr;
+            }
+
+            if (header.m_formatVersion != BakedObjectHeader::BakedObjectVersion)
+            {
+                AZ_Error("BakedObjectFormat", false, "Unsupported baked object format version %u", header.m_formatVersion);
+                return nullptr;
+            }
+
+            if (header.m_classId != expectedClassId)
+            {
+                AZ_Error("BakedObjectFormat", false, "Image was baked for type %s, expected %s",
+                    header.m_classId.ToString<AZStd::string>().c_str(), expectedClassId.ToString<AZStd::string>().c_str());
+                return nullptr;
+            }
+
+            if (header.m_classLayoutVersion != expectedClassLayoutVersion)
+            {
+                AZ_Error("BakedObjectFormat", false, "Image was baked with layout version %u, expected %u; fall back to ObjectStream",
+                    header.m_classLayoutVersion, expectedClassLayoutVersion);
+                return nullptr;
+            }
+
+            const uint64_t payloadOffset = GetPayloadFileOffset(header.m_relocationCount);
+            if ((payloadOffset > bufferSize) || (header.m_payloadSize > bufferSize - payloadOffset))
+            {
+                AZ_Error("BakedObjectFormat", false, "Image is truncated, payload extends past the end of the buffer");
+                return nullptr;
+            }
+
+            uint8_t* const imageBytes = reinterpret_cast<uint8_t*>(buffer);
+            uint8_t* const payload = imageBytes + payloadOffset;
+            const BakedObjectRelocation* relocations = reinterpret_cast<const BakedObjectRelocation*>(imageBytes + sizeof(BakedObjectHeader));
+
+            // Convert every stored payload-relative offset back into a pointer in a single pass
+            for (uint32_t index = 0; index < header.m_relocationCount; ++index)
+            {
+                const BakedObjectRelocation& relocation = relocations[index];
+                if ((relocation.m_pointerOffset + sizeof(uint64_t) > header.m_payloadSize) || (relocation.m_targetOffset > header.m_payloadSize))
+                {
+                    AZ_Error("BakedObjectFormat", false, "Image relocation %u lies outside the payload", index);
+                    return nullptr;
+                }
+                const uint64_t patchedPointer = reinterpret_cast<uint64_t>(payload + relocation.m_targetOffset);
+                memcpy(payload + relocation.m_pointerOffset, &patchedPointer, sizeof(patchedPointer));
+            }
+
+            return payload;
+        }
+    }
+
+    bool SupportsBakedObjectFormat(SerializeContext& serializeContext, const Uuid& classId, uint32_t& outLayoutVersion)
+    {
+        outLayoutVersion = 0;
+
+        const SerializeContext::ClassData* classData = serializeContext.FindClassData(classId);
+        if (classData == nullptr)
+        {
+            return false;
+        }
+
+        Attribute* attribute = classData->FindAttribute(BakedObjectFormatAttribute);
+        if (attribute == nullptr)
+        {
+            return false;
+        }
+
+        AttributeReader attributeReader(nullptr, attribute);
+        return attributeReader.Read<uint32_t>(outLayoutVersion);
+    }
+}
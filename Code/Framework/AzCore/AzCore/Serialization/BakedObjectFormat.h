@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class SerializeContext;
+
+    /**
+     * BakedObjectFormat is a flat, memory-mappable binary object format intended as a load-time
+     * alternative to ObjectStream for asset types with stable in-memory layouts.
+     *
+     * An image consists of a fixed header, a contiguous payload blob containing the object data
+     * with all internal pointers stored as payload-relative offsets, and a relocation table
+     * listing the location of every such pointer. Loading maps (or reads) the file and converts
+     * the offsets back to pointers in a single pass over the relocation table - no reflection
+     * walk and no per-element allocations.
+     *
+     * The format is negotiated per asset type: a type opts in by attaching the
+     * BakedObjectFormatAttribute to its SerializeContext class reflection, with the baked layout
+     * version as the attribute value. Asset handlers consult SupportsBakedObjectFormat before
+     * choosing this format and fall back to ObjectStream otherwise, so adoption can be
+     * incremental and editor/dev loops keep the reflected path.
+     */
+
+    //! SerializeContext class attribute marking a type as supporting the baked object format.
+    //! The attribute value is the uint32_t layout version baked into images of the type.
+    static constexpr Crc32 BakedObjectFormatAttribute = AZ_CRC_CE("BakedObjectFormat");
+
+    //! One pointer inside a baked payload that must be patched after loading.
+    struct BakedObjectRelocation
+    {
+        uint64_t m_pointerOffset = 0; //!< Payload-relative offset of the stored pointer
+        uint64_t m_targetOffset = 0;  //!< Payload-relative offset the pointer must resolve to
+    };
+
+    //! Fixed header at the start of every baked object image.
+    struct BakedObjectHeader
+    {
+        static constexpr uint32_t BakedObjectMagic = 0x445A4B42; // 'BKZD'
+        static constexpr uint32_t BakedObjectVersion = 1;
+
+        uint32_t m_magic = BakedObjectMagic;
+        uint32_t m_formatVersion = BakedObjectVersion;
+        Uuid     m_classId = Uuid::CreateNull(); //!< TypeId of the root object in the payload
+        uint32_t m_classLayoutVersion = 0;       //!< Per-type layout version, from the class attribute
+        uint32_t m_relocationCount = 0;
+        uint64_t m_payloadSize = 0;
+    };
+
+    //! @class BakedObjectWriter
+    //! @brief Accumulates a flat payload and its relocation table and writes the final image.
+    //!
+    //! Used by asset builders: bake the object into the payload with AppendBytes, recording a
+    //! relocation for every internal pointer, then emit the image with Write.
+    class BakedObjectWriter
+    {
+    public:
+
+        BakedObjectWriter(const Uuid& classId, uint32_t classLayoutVersion);
+
+        //! Appends a block of bytes to the payload, padding to the requested alignment.
+        //! @param data      pointer to the bytes to append
+        //! @param size      number of bytes to append
+        //! @param alignment required alignment of the block within the payload
+        //! @return the payload-relative offset the block was stored at
+        uint64_t AppendBytes(const void* data, uint64_t size, uint64_t alignment = alignof(AZStd::max_align_t));
+
+        //! Records that the pointer stored at pointerOffset must resolve to targetOffset on load.
+        //! @param pointerOffset payload-relative offset of the stored pointer
+        //! @param targetOffset  payload-relative offset the pointer refers to
+        void AddRelocation(uint64_t pointerOffset, uint64_t targetOffset);
+
+        //! Writes the complete image (header, relocation table and payload) to the stream.
+        //! @param stream the stream to write the image to
+        //! @return true if the full image was written successfully
+        bool Write(IO::GenericStream& stream) const;
+
+    private:
+
+        Uuid m_classId;
+        uint32_t m_classLayoutVersion = 0;
+        AZStd::vector<uint8_t> m_payload;
+        AZStd::vector<BakedObjectRelocation> m_relocations;
+    };
+
+    //! @class BakedObjectLoader
+    //! @brief Patches a baked object image in place and returns the typed root object.
+    namespace BakedObjectLoader
+    {
+        //! Validates the image and converts all stored offsets back to pointers in one pass.
+        //! The buffer must stay alive (and writable) for the lifetime of the returned object;
+        //! it is typically a mapped file or a buffer read in a single IO operation.
+        //! @param buffer             the complete image, including header
+        //! @param bufferSize         size of the image in bytes
+        //! @param expectedClassId    typeId the caller expects the root object to be
+        //! @param expectedClassLayoutVersion layout version the caller was compiled against
+        //! @return pointer to the patched root object within the buffer, or nullptr if the
+        //!         image is malformed or was baked for a different type or layout version
+        void* PatchInPlace(void* buffer, uint64_t bufferSize, const Uuid& expectedClassId, uint32_t expectedClassLayoutVersion);
+
+        //! Typed helper around PatchInPlace.
+        template <typename ObjectType>
+        ObjectType* PatchInPlace(void* buffer, uint64_t bufferSize, uint32_t expectedClassLayoutVersion)
+        {
+            return reinterpret_cast<ObjectType*>(PatchInPlace(buffer, bufferSize, AzTypeInfo<ObjectType>::Uuid(), expectedClassLayoutVersion));
+        }
+    }
+
+    //! Returns whether the given type has opted into the baked object format.
+    //! @param serializeContext the serialize context holding the type's reflection data
+    //! @param classId          typeId of the asset type to query
+    //! @param outLayoutVersion filled with the type's baked layout version when supported
+    //! @return true if the type reflects the BakedObjectFormatAttribute, false otherwise
+    bool SupportsBakedObjectFormat(SerializeContext& serializeContext, const Uuid& classId, uint32_t& outLayoutVersion);
+}
@@ -205,6 +205,22 @@ namespace AZ::JsonSerializationUtils
     }
 
 
+    // Builds the error message for a document whose parse failed, reporting the line the error occurred on.
+    static AZStd::string GetJsonParseErrorMessage(AZStd::string_view jsonText, const rapidjson::Document& jsonDocument)
+    {
+        size_t lineNumber = 1;
+
+        const size_t errorOffset = jsonDocument.GetErrorOffset();
+        for (size_t searchOffset = jsonText.find('\n');
+            searchOffset < errorOffset && searchOffset < AZStd::string::npos;
+            searchOffset = jsonText.find('\n', searchOffset + 1))
+        {
+            lineNumber++;
+        }
+
+        return AZStd::string::format("JSON parse error at line %zu: %s", lineNumber, rapidjson::GetParseError_En(jsonDocument.GetParseError()));
+    }
+
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonString(AZStd::string_view jsonText)
     {
         if (jsonText.empty())
@@ -216,17 +232,7 @@ namespace AZ::JsonSerializationUtils
         jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data(), jsonText.size());
         if (jsonDocument.HasParseError())
         {
-            size_t lineNumber = 1;
-
-            const size_t errorOffset = jsonDocument.GetErrorOffset();
-            for (size_t searchOffset = jsonText.find('\n');
-                searchOffset < errorOffset && searchOffset < AZStd::string::npos;
-                searchOffset = jsonText.find('\n', searchOffset + 1))
-            {
-                lineNumber++;
-            }
-
-            return AZ::Failure(AZStd::string::format("JSON parse error at line %zu: %s", lineNumber, rapidjson::GetParseError_En(jsonDocument.GetParseError())));
+            return AZ::Failure(GetJsonParseErrorMessage(jsonText, jsonDocument));
         }
         else
         {
@@ -234,6 +240,52 @@ namespace AZ::JsonSerializationUtils
         }
     }
 
+    AZ::Outcome<InSituJsonDocument, AZStd::string> ReadJsonTextInSitu(AZStd::vector<char>&& jsonText)
+    {
+        if (jsonText.empty() || jsonText.front() == '\0')
+        {
+            return AZ::Failure(AZStd::string("Failed to parse JSON: input string is empty."));
+        }
+
+        // In-situ parsing requires a mutable, null-terminated buffer as unescaped strings and their
+        // terminators are written back into it.
+        if (jsonText.back() != '\0')
+        {
+            jsonText.push_back('\0');
+        }
+
+        InSituJsonDocument result;
+        result.m_jsonText = AZStd::move(jsonText);
+        result.m_document.ParseInsitu<rapidjson::kParseCommentsFlag>(result.m_jsonText.data());
+        if (result.m_document.HasParseError())
+        {
+            // Note that the line number is approximate as the parser has already modified the buffer
+            // up to the point of the error.
+            return AZ::Failure(GetJsonParseErrorMessage(
+                AZStd::string_view{ result.m_jsonText.data(), result.m_jsonText.size() }, result.m_document));
+        }
+
+        return AZ::Success(AZStd::move(result));
+    }
+
+    AZ::Outcome<InSituJsonDocument, AZStd::string> ReadJsonStreamInSitu(IO::GenericStream& stream)
+    {
+        IO::SizeType length = stream.GetLength();
+
+        AZStd::vector<char> memoryBuffer;
+        memoryBuffer.resize_no_construct(static_cast<AZStd::vector<char>::size_type>(static_cast<AZStd::vector<char>::size_type>(length) + 1));
+
+        IO::SizeType bytesRead = stream.Read(length, memoryBuffer.data());
+        if (bytesRead != length)
+        {
+            return AZ::Failure(AZStd::string{"Cannot to read input stream."});
+        }
+
+        memoryBuffer.back() = 0;
+
+        return ReadJsonTextInSitu(AZStd::move(memoryBuffer));
+    }
+
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream)
     {
         IO::SizeType length = stream.GetLength();
@@ -361,13 +413,15 @@ namespace AZ::JsonSerializationUtils
             return AZ::Failure(prepare.GetError());
         }
 
-        auto parseResult = ReadJsonStream(stream);
+        // Parse in place so the document's strings alias the stream buffer; the document never
+        // outlives this function, and large content avoids a second copy of every string.
+        auto parseResult = ReadJsonStreamInSitu(stream);
         if (!parseResult.IsSuccess())
         {
             return AZ::Failure(parseResult.GetError());
         }
 
-        const rapidjson::Document& jsonDocument = parseResult.GetValue();
+        const rapidjson::Document& jsonDocument = parseResult.GetValue().m_document;
 
         auto validateResult = ValidateJsonClassHeader(jsonDocument);
         if (!validateResult.IsSuccess())
@@ -409,18 +463,20 @@ namespace AZ::JsonSerializationUtils
             return AZ::Failure(prepare.GetError());
         }
 
-        auto parseResult = ReadJsonStream(stream);
+        // Parse in place so the document's strings alias the stream buffer; the document never
+        // outlives this function.
+        auto parseResult = ReadJsonStreamInSitu(stream);
         if (!parseResult.IsSuccess())
         {
             return AZ::Failure(parseResult.GetError());
         }
 
-        const rapidjson::Document& jsonDocument = parseResult.GetValue();
+        const rapidjson::Document& jsonDocument = parseResult.GetValue().m_document;
 
         auto validateResult = ValidateJsonClassHeader(jsonDocument);
-        if (!parseResult.IsSuccess())
+        if (!validateResult.IsSuccess())
         {
-            return AZ::Failure(parseResult.GetError());
+            return AZ::Failure(validateResult.GetError());
         }
 
         const char* className = jsonDocument.FindMember(ClassNameTag)->value.GetString();
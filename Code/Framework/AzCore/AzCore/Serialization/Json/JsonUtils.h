@@ -9,6 +9,7 @@
 
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/JSON/document.h>
@@ -77,7 +78,26 @@ namespace AZ
 
         //! Parse a json stream. Returns a failure with error message if the content is not valid JSON.
         AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream);
-        
+
+        //! A parsed json document paired with the text buffer its string values alias.
+        //! Produced by the in-situ read functions below; keep the whole struct alive for as long
+        //! as the document is in use.
+        struct InSituJsonDocument
+        {
+            AZStd::vector<char> m_jsonText; //!< Mutable text buffer the document's strings point into
+            rapidjson::Document m_document;
+        };
+
+        //! Parse json text in place, taking ownership of the buffer. String values in the resulting
+        //! document alias the buffer instead of being copied into the document allocator, keeping peak
+        //! memory bounded to a single copy of the text for string-heavy content such as large prefabs.
+        //! A null terminator is appended to the buffer if not already present.
+        AZ::Outcome<InSituJsonDocument, AZStd::string> ReadJsonTextInSitu(AZStd::vector<char>&& jsonText);
+
+        //! Read a json stream into a single buffer and parse it in place with ReadJsonTextInSitu,
+        //! avoiding the per-string copies made by ReadJsonStream.
+        AZ::Outcome<InSituJsonDocument, AZStd::string> ReadJsonStreamInSitu(IO::GenericStream& stream);
+
         //! Load object with known class type
         AZ::Outcome<void, AZStd::string> LoadObjectFromStringByType(void* objectToLoad, const Uuid& objectType, AZStd::string_view source,
             const JsonDeserializerSettings* settings = nullptr);
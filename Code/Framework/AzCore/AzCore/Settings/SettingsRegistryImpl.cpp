@@ -8,9 +8,11 @@
 
 #include <cctype>
 #include <cerrno>
+#include <cstring>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/FileReader.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/JSON/error/en.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -47,6 +49,239 @@ namespace AZ::SettingsRegistryImplInternal
 
         return Type::NoType;
     }
+
+    // The settings snapshot is a type-tagged, depth-first binary encoding of the settings document.
+    // Values deserialize straight into rapidjson values without any text parsing or merge work.
+    inline constexpr uint32_t SettingsSnapshotMagic = 0x52535A41; // 'AZSR'
+    inline constexpr uint32_t SettingsSnapshotVersion = 1;
+
+    enum class SnapshotNodeType : uint8_t
+    {
+        Null,
+        False,
+        True,
+        Int64,
+        Uint64,
+        Double,
+        String,
+        Object,
+        Array
+    };
+
+    struct SnapshotHeader
+    {
+        uint32_t m_magic = SettingsSnapshotMagic;
+        uint32_t m_version = SettingsSnapshotVersion;
+        uint64_t m_payloadSize = 0;
+    };
+
+    template<typename T>
+    void SnapshotWrite(AZStd::vector<uint8_t>& payload, const T& value)
+    {
+        const auto* valueBytes = reinterpret_cast<const uint8_t*>(&value);
+        payload.insert(payload.end(), valueBytes, valueBytes + sizeof(value));
+    }
+
+    void SnapshotWriteString(AZStd::vector<uint8_t>& payload, const char* text, uint32_t length)
+    {
+        SnapshotWrite(payload, length);
+        payload.insert(payload.end(), text, text + length);
+    }
+
+    void SnapshotWriteValue(AZStd::vector<uint8_t>& payload, const rapidjson::Value& value)
+    {
+        switch (value.GetType())
+        {
+        case rapidjson::Type::kNullType:
+            SnapshotWrite(payload, SnapshotNodeType::Null);
+            break;
+        case rapidjson::Type::kFalseType:
+            SnapshotWrite(payload, SnapshotNodeType::False);
+            break;
+        case rapidjson::Type::kTrueType:
+            SnapshotWrite(payload, SnapshotNodeType::True);
+            break;
+        case rapidjson::Type::kNumberType:
+            if (value.IsInt64())
+            {
+                SnapshotWrite(payload, SnapshotNodeType::Int64);
+                SnapshotWrite(payload, value.GetInt64());
+            }
+            else if (value.IsUint64())
+            {
+                SnapshotWrite(payload, SnapshotNodeType::Uint64);
+                SnapshotWrite(payload, value.GetUint64());
+            }
+            else
+            {
+                SnapshotWrite(payload, SnapshotNodeType::Double);
+                SnapshotWrite(payload, value.GetDouble());
+            }
+            break;
+        case rapidjson::Type::kStringType:
+            SnapshotWrite(payload, SnapshotNodeType::String);
+            SnapshotWriteString(payload, value.GetString(), value.GetStringLength());
+            break;
+        case rapidjson::Type::kObjectType:
+            SnapshotWrite(payload, SnapshotNodeType::Object);
+            SnapshotWrite(payload, static_cast<uint32_t>(value.MemberCount()));
+            for (const auto& member : value.GetObject())
+            {
+                SnapshotWriteString(payload, member.name.GetString(), member.name.GetStringLength());
+                SnapshotWriteValue(payload, member.value);
+            }
+            break;
+        case rapidjson::Type::kArrayType:
+            SnapshotWrite(payload, SnapshotNodeType::Array);
+            SnapshotWrite(payload, static_cast<uint32_t>(value.Size()));
+            for (const rapidjson::Value& element : value.GetArray())
+            {
+                SnapshotWriteValue(payload, element);
+            }
+            break;
+        }
+    }
+
+    struct SnapshotReader
+    {
+        const uint8_t* m_cursor = nullptr;
+        const uint8_t* m_end = nullptr;
+
+        template<typename T>
+        bool Read(T& value)
+        {
+            if (static_cast<size_t>(m_end - m_cursor) < sizeof(value))
+            {
+                return false;
+            }
+            memcpy(&value, m_cursor, sizeof(value));
+            m_cursor += sizeof(value);
+            return true;
+        }
+
+        bool ReadString(const char*& text, uint32_t& length)
+        {
+            if (!Read(length) || static_cast<size_t>(m_end - m_cursor) < length)
+            {
+                return false;
+            }
+            text = reinterpret_cast<const char*>(m_cursor);
+            m_cursor += length;
+            return true;
+        }
+    };
+
+    bool SnapshotReadValue(SnapshotReader& reader, rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator)
+    {
+        SnapshotNodeType nodeType;
+        if (!reader.Read(nodeType))
+        {
+            return false;
+        }
+
+        switch (nodeType)
+        {
+        case SnapshotNodeType::Null:
+            value.SetNull();
+            return true;
+        case SnapshotNodeType::False:
+            value.SetBool(false);
+            return true;
+        case SnapshotNodeType::True:
+            value.SetBool(true);
+            return true;
+        case SnapshotNodeType::Int64:
+        {
+            int64_t number;
+            if (!reader.Read(number))
+            {
+                return false;
+            }
+            value.SetInt64(number);
+            return true;
+        }
+        case SnapshotNodeType::Uint64:
+        {
+            uint64_t number;
+            if (!reader.Read(number))
+            {
+                return false;
+            }
+            value.SetUint64(number);
+            return true;
+        }
+        case SnapshotNodeType::Double:
+        {
+            double number;
+            if (!reader.Read(number))
+            {
+                return false;
+            }
+            value.SetDouble(number);
+            return true;
+        }
+        case SnapshotNodeType::String:
+        {
+            const char* text;
+            uint32_t length;
+            if (!reader.ReadString(text, length))
+            {
+                return false;
+            }
+            value.SetString(text, length, allocator);
+            return true;
+        }
+        case SnapshotNodeType::Object:
+        {
+            uint32_t memberCount;
+            if (!reader.Read(memberCount))
+            {
+                return false;
+            }
+            value.SetObject();
+            value.MemberReserve(memberCount, allocator);
+            for (uint32_t i = 0; i < memberCount; ++i)
+            {
+                const char* text;
+                uint32_t length;
+                if (!reader.ReadString(text, length))
+                {
+                    return false;
+                }
+                rapidjson::Value memberName(text, length, allocator);
+                rapidjson::Value memberValue;
+                if (!SnapshotReadValue(reader, memberValue, allocator))
+                {
+                    return false;
+                }
+                value.AddMember(memberName, memberValue, allocator);
+            }
+            return true;
+        }
+        case SnapshotNodeType::Array:
+        {
+            uint32_t elementCount;
+            if (!reader.Read(elementCount))
+            {
+                return false;
+            }
+            value.SetArray();
+            value.Reserve(elementCount, allocator);
+            for (uint32_t i = 0; i < elementCount; ++i)
+            {
+                rapidjson::Value element;
+                if (!SnapshotReadValue(reader, element, allocator))
+                {
+                    return false;
+                }
+                value.PushBack(element, allocator);
+            }
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
 }
 
 namespace AZ
@@ -700,6 +935,68 @@ namespace AZ
         return true;
     }
 
+    bool SettingsRegistryImpl::SaveSnapshot(AZ::IO::GenericStream& stream) const
+    {
+        using namespace SettingsRegistryImplInternal;
+
+        AZStd::vector<uint8_t> payload;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            SnapshotWriteValue(payload, m_settings);
+        }
+
+        SnapshotHeader header;
+        header.m_payloadSize = payload.size();
+        if (stream.Write(sizeof(header), &header) != sizeof(header))
+        {
+            return false;
+        }
+        return stream.Write(payload.size(), payload.data()) == payload.size();
+    }
+
+    bool SettingsRegistryImpl::LoadSnapshot(const void* buffer, size_t bufferSize)
+    {
+        using namespace SettingsRegistryImplInternal;
+
+        SnapshotHeader header;
+        if (bufferSize < sizeof(header))
+        {
+            AZ_Error("Settings Registry", false, "Settings snapshot is smaller than the snapshot header.");
+            return false;
+        }
+        memcpy(&header, buffer, sizeof(header));
+
+        if (header.m_magic != SettingsSnapshotMagic || header.m_version != SettingsSnapshotVersion)
+        {
+            AZ_Error("Settings Registry", false, "Settings snapshot has an unrecognized header; it needs to be rebuilt.");
+            return false;
+        }
+        if (header.m_payloadSize > bufferSize - sizeof(header))
+        {
+            AZ_Error("Settings Registry", false, "Settings snapshot is truncated, payload extends past the end of the buffer.");
+            return false;
+        }
+
+        const auto* payload = reinterpret_cast<const uint8_t*>(buffer) + sizeof(header);
+        SnapshotReader reader{ payload, payload + header.m_payloadSize };
+
+        auto rootType = AZ::SettingsRegistryInterface::Type::NoType;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            m_settings.SetNull();
+            if (!SnapshotReadValue(reader, m_settings, m_settings.GetAllocator()) || reader.m_cursor != reader.m_end)
+            {
+                AZ_Error("Settings Registry", false, "Settings snapshot payload is malformed; it needs to be rebuilt.");
+                m_settings.SetObject();
+                return false;
+            }
+            rootType = RapidjsonToSettingsRegistryType(m_settings);
+        }
+
+        SignalNotifier("", rootType);
+        return true;
+    }
+
     bool SettingsRegistryImpl::MergeSettingsFile(AZStd::string_view path, Format format, AZStd::string_view rootKey,
         AZStd::vector<char>* scratchBuffer)
     {
@@ -21,6 +21,11 @@
 // Using a define instead of a static string to avoid the need for temporary buffers to composite the full paths.
 #define AZ_SETTINGS_REGISTRY_HISTORY_KEY "/Amazon/AzCore/Runtime/Registry/FileHistory"
 
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
 namespace AZ
 {
     class StackedString;
@@ -84,6 +89,22 @@ namespace AZ
         bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform, AZStd::string_view anchorKey = "", AZStd::vector<char>* scratchBuffer = nullptr) override;
 
+        //! Writes a binary snapshot of the fully-merged registry to the stream.
+        //! The snapshot is a direct encoding of the settings document, so restoring it with LoadSnapshot
+        //! skips the per-file JSON parse and merge work entirely. It is intended to be produced at
+        //! build or bundle time, after all .setreg files have been merged.
+        //! @param stream The stream to write the snapshot to.
+        //! @return True if the complete snapshot was written to the stream.
+        bool SaveSnapshot(AZ::IO::GenericStream& stream) const;
+
+        //! Replaces the contents of the registry with a previously saved binary snapshot.
+        //! Genuinely dynamic settings (command line overrides, user settings) should be merged
+        //! on top after the snapshot has been loaded.
+        //! @param buffer The complete snapshot, typically a memory-mapped file or a buffer read in one IO operation.
+        //! @param bufferSize The size of the snapshot in bytes.
+        //! @return True if the snapshot was validated and loaded into the registry.
+        bool LoadSnapshot(const void* buffer, size_t bufferSize);
+
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
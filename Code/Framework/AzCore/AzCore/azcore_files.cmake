@@ -337,6 +337,8 @@ set(FILES
     Math/Transform.cpp
     Math/Transform.h
     Math/Transform.inl
+    Math/TransformBatch.cpp
+    Math/TransformBatch.h
     Math/TransformSerializer.cpp
     Math/TransformSerializer.h
     Math/Uuid.cpp
@@ -379,6 +381,8 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameAllocator.cpp
+    Memory/FrameAllocator.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -492,6 +496,8 @@ set(FILES
     Serialization/IdUtils.h
     Serialization/Utils.h
     Serialization/SerializationUtils.cpp
+    Serialization/BakedObjectFormat.cpp
+    Serialization/BakedObjectFormat.h
     Serialization/ObjectStream.cpp
     Serialization/ObjectStream.h
     Serialization/SerializeContext.cpp
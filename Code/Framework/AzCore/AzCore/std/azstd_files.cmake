@@ -98,6 +98,7 @@ set(FILES
     parallel/containers/lock_free_intrusive_stack.h
     parallel/containers/lock_free_intrusive_stamped_stack.h
     parallel/containers/lock_free_queue.h
+    parallel/containers/lock_free_ring_queue.h
     parallel/containers/lock_free_stack.h
     parallel/containers/lock_free_stamped_queue.h
     parallel/containers/lock_free_stamped_stack.h
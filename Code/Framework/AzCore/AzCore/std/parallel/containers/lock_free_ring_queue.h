@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    /**
+     * A bounded lock-free multi-producer/multi-consumer ring queue (Vyukov style). Unlike
+     * lock_free_queue the capacity is fixed at construction and no per-element allocation is
+     * performed, so any allocator can be used and the hot path is a single compare-exchange
+     * on a pre-allocated cell. push fails when the queue is full and pop fails when it is
+     * empty, callers are expected to handle both.
+     */
+    template<typename T, typename Allocator = AZStd::allocator>
+    class lock_free_ring_queue
+    {
+    public:
+        typedef T*                                  pointer;
+        typedef const T*                            const_pointer;
+        typedef T&                                  reference;
+        typedef const T&                            const_reference;
+        typedef typename Allocator::difference_type difference_type;
+        typedef typename Allocator::size_type       size_type;
+        typedef Allocator                           allocator_type;
+        typedef T                                   value_type;
+
+        ///Creates the queue with at least the requested capacity, rounded up to a power of two.
+        explicit lock_free_ring_queue(size_type capacity);
+
+        ~lock_free_ring_queue();
+
+        ///Attempts to push a value onto the back of the queue. Returns false if the queue was full.
+        bool push(const_reference value);
+
+        ///Attempts to pop a value from the front of the queue. Returns false if the queue was empty,
+        ///otherwise the popped value is stored in value_out and returns true.
+        bool pop(pointer value_out);
+
+        ///Tests if the queue is empty, limited utility for a concurrent container.
+        bool empty() const;
+
+        ///Returns the fixed capacity of the queue.
+        size_type capacity() const { return m_mask + 1; }
+
+    private:
+        //non-copyable
+        lock_free_ring_queue(const lock_free_ring_queue&);
+        lock_free_ring_queue& operator=(const lock_free_ring_queue&);
+
+        struct cell_type
+        {
+            atomic<size_type> m_sequence;
+            T m_value;
+        };
+
+        cell_type* m_cells;
+        size_type m_mask;
+        allocator_type m_allocator;
+
+        //Producers and consumers run on their own counters so they only contend with their own kind.
+        alignas(64) atomic<size_type> m_enqueuePos;
+        alignas(64) atomic<size_type> m_dequeuePos;
+    };
+
+    //============================================================================================================
+    //============================================================================================================
+    //============================================================================================================
+
+    template<typename T, typename Allocator>
+    inline lock_free_ring_queue<T, Allocator>::lock_free_ring_queue(size_type capacity)
+        : m_enqueuePos(0)
+        , m_dequeuePos(0)
+    {
+        AZ_Assert(capacity >= 2, "lock_free_ring_queue requires a capacity of at least 2");
+        size_type roundedCapacity = 2;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity <<= 1;
+        }
+        m_mask = roundedCapacity - 1;
+
+        m_cells = reinterpret_cast<cell_type*>(m_allocator.allocate(roundedCapacity * sizeof(cell_type), alignof(cell_type)));
+        for (size_type i = 0; i < roundedCapacity; ++i)
+        {
+            m_cells[i].m_sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    template<typename T, typename Allocator>
+    inline lock_free_ring_queue<T, Allocator>::~lock_free_ring_queue()
+    {
+        T value;
+        while (pop(&value)) {} //destroy any remaining values
+        m_allocator.deallocate(m_cells, (m_mask + 1) * sizeof(cell_type), alignof(cell_type));
+    }
+
+    template<typename T, typename Allocator>
+    inline bool lock_free_ring_queue<T, Allocator>::push(const_reference value)
+    {
+        cell_type* cell;
+        size_type pos = m_enqueuePos.load(memory_order_relaxed);
+        for (;;)
+        {
+            cell = &m_cells[pos & m_mask];
+            size_type sequence = cell->m_sequence.load(memory_order_acquire);
+            difference_type difference = static_cast<difference_type>(sequence) - static_cast<difference_type>(pos);
+            if (difference == 0)
+            {
+                //the cell is free, try to claim it
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                //the cell is still occupied by a value a full lap behind, the queue is full
+                return false;
+            }
+            else
+            {
+                //another producer claimed this cell, reload and try the next one
+                pos = m_enqueuePos.load(memory_order_relaxed);
+            }
+        }
+
+        new(&cell->m_value) T(value);
+        cell->m_sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool lock_free_ring_queue<T, Allocator>::pop(pointer value_out)
+    {
+        cell_type* cell;
+        size_type pos = m_dequeuePos.load(memory_order_relaxed);
+        for (;;)
+        {
+            cell = &m_cells[pos & m_mask];
+            size_type sequence = cell->m_sequence.load(memory_order_acquire);
+            difference_type difference = static_cast<difference_type>(sequence) - static_cast<difference_type>(pos + 1);
+            if (difference == 0)
+            {
+                //the cell holds a value, try to claim it
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                //no producer has written to this cell yet, the queue is empty
+                return false;
+            }
+            else
+            {
+                //another consumer claimed this cell, reload and try the next one
+                pos = m_dequeuePos.load(memory_order_relaxed);
+            }
+        }
+
+        *value_out = AZStd::move(cell->m_value);
+        cell->m_value.~T();
+        cell->m_sequence.store(pos + m_mask + 1, memory_order_release);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool lock_free_ring_queue<T, Allocator>::empty() const
+    {
+        return m_enqueuePos.load(memory_order_acquire) == m_dequeuePos.load(memory_order_acquire);
+    }
+}
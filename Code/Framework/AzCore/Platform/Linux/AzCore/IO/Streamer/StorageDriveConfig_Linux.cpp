@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        [[maybe_unused]] const HardwareInformation& hardware, [[maybe_unused]] AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (StorageDriveLinux::IsIoUringSupported())
+        {
+            return AZStd::make_shared<StorageDriveLinux>(m_maxFileHandles, m_queueDepth);
+        }
+
+        // Older kernels without io_uring fall back to the generic blocking drive.
+        AZ_Printf("Streamer", "io_uring is not available on this kernel, falling back to the generic storage drive.\n");
+        return AZStd::make_shared<StorageDrive>(m_maxFileHandles);
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth);
+        }
+    }
+} // namespace AZ::IO
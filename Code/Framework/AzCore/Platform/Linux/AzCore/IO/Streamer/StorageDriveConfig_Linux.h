@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{0D95C1A9-2BF5-4E04-95DF-9E2E7B0ECE3D}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator, 0);
+
+        ~LinuxStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        //! The number of reads that are kept in flight with the kernel at the same time.
+        AZ::u32 m_queueDepth{ 64 };
+    };
+} // namespace AZ::IO
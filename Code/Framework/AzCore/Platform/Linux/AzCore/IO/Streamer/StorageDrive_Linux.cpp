@@ -0,0 +1,703 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <limits>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/typetraits/decay.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+namespace AZ::IO
+{
+    namespace Platform
+    {
+        namespace
+        {
+            int IoUringSetup(unsigned entries, io_uring_params* params)
+            {
+                return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+            }
+
+            int IoUringEnter(int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+            {
+                return static_cast<int>(syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+            }
+        } // namespace
+
+        IoUring::~IoUring()
+        {
+            Destroy();
+        }
+
+        bool IoUring::Create(AZ::u32 queueDepth)
+        {
+            io_uring_params params;
+            memset(&params, 0, sizeof(params));
+
+            m_ringFd = IoUringSetup(queueDepth, &params);
+            if (m_ringFd < 0)
+            {
+                return false;
+            }
+
+            m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(AZ::u32);
+            m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+            // Kernels with IORING_FEAT_SINGLE_MMAP map both rings with a single call.
+            const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMmap)
+            {
+                m_sqRingSize = m_cqRingSize = AZStd::max(m_sqRingSize, m_cqRingSize);
+            }
+
+            m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+            if (m_sqRing == MAP_FAILED)
+            {
+                m_sqRing = nullptr;
+                Destroy();
+                return false;
+            }
+
+            if (singleMmap)
+            {
+                m_cqRing = m_sqRing;
+            }
+            else
+            {
+                m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+                if (m_cqRing == MAP_FAILED)
+                {
+                    m_cqRing = nullptr;
+                    Destroy();
+                    return false;
+                }
+            }
+
+            m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            m_sqes = reinterpret_cast<io_uring_sqe*>(
+                mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES));
+            if (m_sqes == MAP_FAILED)
+            {
+                m_sqes = nullptr;
+                Destroy();
+                return false;
+            }
+
+            auto sqBase = reinterpret_cast<char*>(m_sqRing);
+            m_sqHead = reinterpret_cast<AZ::u32*>(sqBase + params.sq_off.head);
+            m_sqTail = reinterpret_cast<AZ::u32*>(sqBase + params.sq_off.tail);
+            m_sqMask = reinterpret_cast<AZ::u32*>(sqBase + params.sq_off.ring_mask);
+            m_sqArray = reinterpret_cast<AZ::u32*>(sqBase + params.sq_off.array);
+
+            auto cqBase = reinterpret_cast<char*>(m_cqRing);
+            m_cqHead = reinterpret_cast<AZ::u32*>(cqBase + params.cq_off.head);
+            m_cqTail = reinterpret_cast<AZ::u32*>(cqBase + params.cq_off.tail);
+            m_cqMask = reinterpret_cast<AZ::u32*>(cqBase + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe*>(cqBase + params.cq_off.cqes);
+
+            return true;
+        }
+
+        void IoUring::Destroy()
+        {
+            if (m_sqes)
+            {
+                munmap(m_sqes, m_sqesSize);
+                m_sqes = nullptr;
+            }
+            if (m_cqRing && m_cqRing != m_sqRing)
+            {
+                munmap(m_cqRing, m_cqRingSize);
+            }
+            m_cqRing = nullptr;
+            if (m_sqRing)
+            {
+                munmap(m_sqRing, m_sqRingSize);
+                m_sqRing = nullptr;
+            }
+            if (m_ringFd >= 0)
+            {
+                close(m_ringFd);
+                m_ringFd = -1;
+            }
+        }
+
+        bool IoUring::QueueRead(int fileDescriptor, iovec* vec, AZ::u64 offset, void* userData)
+        {
+            const AZ::u32 mask = *m_sqMask;
+            const AZ::u32 head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+            const AZ::u32 tail = *m_sqTail;
+            if (tail - head > mask)
+            {
+                return false;
+            }
+
+            const AZ::u32 index = tail & mask;
+            io_uring_sqe& sqe = m_sqes[index];
+            memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_READV;
+            sqe.fd = fileDescriptor;
+            sqe.off = offset;
+            sqe.addr = reinterpret_cast<AZ::u64>(vec);
+            sqe.len = 1;
+            sqe.user_data = reinterpret_cast<AZ::u64>(userData);
+
+            m_sqArray[index] = index;
+            __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+            ++m_pendingSubmissions;
+            return true;
+        }
+
+        AZ::u32 IoUring::Submit()
+        {
+            if (m_pendingSubmissions == 0)
+            {
+                return 0;
+            }
+
+            int submitted = IoUringEnter(m_ringFd, m_pendingSubmissions, 0, 0);
+            if (submitted < 0)
+            {
+                AZ_Error("Streamer", false, "io_uring_enter failed: %s.", strerror(errno));
+                return 0;
+            }
+            m_pendingSubmissions -= submitted;
+            return aznumeric_cast<AZ::u32>(submitted);
+        }
+
+        bool IoUring::PopCompletion(void** userData, AZ::s32& result)
+        {
+            const AZ::u32 head = *m_cqHead;
+            const AZ::u32 tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+            if (head == tail)
+            {
+                return false;
+            }
+
+            const io_uring_cqe& cqe = m_cqes[head & *m_cqMask];
+            *userData = reinterpret_cast<void*>(cqe.user_data);
+            result = cqe.res;
+            __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+            return true;
+        }
+    } // namespace Platform
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    bool StorageDriveLinux::IsIoUringSupported()
+    {
+        Platform::IoUring probe;
+        return probe.Create(8);
+    }
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 queueDepth)
+        : StreamStackEntry("Storage drive (Linux io_uring)")
+        , m_queueDepth(queueDepth)
+    {
+        [[maybe_unused]] bool created = m_ring.Create(queueDepth);
+        AZ_Assert(created, "StorageDriveLinux created on a kernel without io_uring support. "
+            "Use StorageDriveLinux::IsIoUringSupported to check before creating this stack entry.");
+
+        m_fileLastUsed.resize(maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+        m_filePaths.resize(maxFileHandles);
+        m_fileDescriptors.resize(maxFileHandles, -1);
+
+        m_inFlight.resize(queueDepth);
+        m_freeSlots.reserve(queueDepth);
+        for (u32 i = 0; i < queueDepth; ++i)
+        {
+            m_freeSlots.push_back(queueDepth - i - 1);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        FlushEntireCache();
+    }
+
+    void StorageDriveLinux::SetNext(AZStd::shared_ptr<StreamStackEntry> /*next*/)
+    {
+        AZ_Assert(false, "StorageDriveLinux isn't allowed to have a node to forward requests to.");
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                CancelRequest(request, args.m_target);
+                return;
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                {
+                    FlushCache(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                {
+                    FlushEntireCache();
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+                {
+                    Report(args);
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool workDone = false;
+
+        // Move as many pending requests as possible into free in-flight slots.
+        u32 issued = 0;
+        while (!m_pendingRequests.empty() && !m_freeSlots.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            bool handled = true;
+            AZStd::visit([this, request, &handled, &issued](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                {
+                    if (IssueRead(request))
+                    {
+                        ++issued;
+                    }
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                }
+                else
+                {
+                    handled = false;
+                }
+            }, request->GetCommand());
+            AZ_Assert(handled, "A request was queued on StorageDriveLinux that can't be processed.");
+
+            m_pendingRequests.pop_front();
+            workDone = true;
+        }
+
+        if (issued > 0)
+        {
+            TIMED_AVERAGE_WINDOW_SCOPE(m_readTimeAverage);
+            m_ring.Submit();
+        }
+
+        ReapCompletions(workDone);
+        return workDone;
+    }
+
+    bool StorageDriveLinux::IssueRead(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "FileRequest queued on StorageDriveLinux to be read didn't contain read data.");
+
+        int fileDescriptor = OpenFile(data->m_path);
+        if (fileDescriptor < 0)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return false;
+        }
+
+        AZ_Assert(!m_freeSlots.empty(), "IssueRead called without any free in-flight slots.");
+        u32 slot = m_freeSlots.back();
+
+        InFlightRead& read = m_inFlight[slot];
+        read.m_request = request;
+        read.m_vec.iov_base = data->m_output;
+        read.m_vec.iov_len = data->m_size;
+
+        if (!m_ring.QueueRead(fileDescriptor, &read.m_vec, data->m_offset, &read))
+        {
+            // The submission ring is full, keep the request pending and try again next cycle.
+            read.m_request = nullptr;
+            m_pendingRequests.push_front(request);
+            return false;
+        }
+
+        m_freeSlots.pop_back();
+        m_activeOffset = data->m_offset + data->m_size;
+        return true;
+    }
+
+    void StorageDriveLinux::ReapCompletions(bool& workDone)
+    {
+        void* userData = nullptr;
+        AZ::s32 result = 0;
+        while (m_ring.PopCompletion(&userData, result))
+        {
+            auto read = reinterpret_cast<InFlightRead*>(userData);
+            FileRequest* request = read->m_request;
+            AZ_Assert(request, "io_uring completed a read that has no associated file request.");
+
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            const bool success = data && result >= 0 && aznumeric_cast<u64>(result) == data->m_size;
+            if (success)
+            {
+                m_readSizeAverage.PushEntry(data->m_size);
+            }
+            request->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+
+            read->m_request = nullptr;
+            m_freeSlots.push_back(aznumeric_cast<u32>(read - m_inFlight.data()));
+            workDone = true;
+        }
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        s32 availableSlots = aznumeric_cast<s32>(m_freeSlots.size()) - aznumeric_cast<s32>(m_pendingRequests.size());
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, availableSlots);
+        status.m_isIdle = status.m_isIdle && m_pendingRequests.empty() && m_freeSlots.size() == m_inFlight.size();
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != s_fileNotFound)
+        {
+            activeFile = &m_filePaths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Estimate the in-flight reads, then the requests in this stack entry.
+        for (const InFlightRead& read : m_inFlight)
+        {
+            if (read.m_request)
+            {
+                EstimateCompletionTimeForRequest(read.m_request, now, activeFile, activeOffset);
+            }
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request,
+        AZStd::chrono::system_clock::time_point& startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds averageTime = m_getFileExistsTimeAverage.CalculateAverage();
+                startTime += averageTime;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds averageTime = m_getFileMetaDataTimeAverage.CalculateAverage();
+                startTime += averageTime;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindFileInCache(*targetFile) == s_fileNotFound)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                startTime += s_averageSeekTime;
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+            else if (activeOffset != offset)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    int StorageDriveLinux::OpenFile(const RequestPath& filePath)
+    {
+        // If the file is already open, use that file descriptor and update its last touched time.
+        size_t cacheIndex = FindFileInCache(filePath);
+        if (cacheIndex != s_fileNotFound)
+        {
+            m_fileLastUsed[cacheIndex] = AZStd::chrono::high_resolution_clock::now();
+            m_activeCacheSlot = cacheIndex;
+            return m_fileDescriptors[cacheIndex];
+        }
+
+        // If the file is not open, eject the entry from the cache that hasn't been used for the longest time
+        // and open the file for reading.
+        AZStd::chrono::system_clock::time_point oldest = m_fileLastUsed[0];
+        cacheIndex = 0;
+        size_t numFiles = m_filePaths.size();
+        for (size_t i = 1; i < numFiles; ++i)
+        {
+            if (m_fileLastUsed[i] < oldest)
+            {
+                oldest = m_fileLastUsed[i];
+                cacheIndex = i;
+            }
+        }
+
+        TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+        int fileDescriptor = open(filePath.GetAbsolutePath(), O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return -1;
+        }
+
+        if (m_fileDescriptors[cacheIndex] >= 0)
+        {
+            close(m_fileDescriptors[cacheIndex]);
+        }
+        m_fileLastUsed[cacheIndex] = AZStd::chrono::high_resolution_clock::now();
+        m_fileDescriptors[cacheIndex] = fileDescriptor;
+        m_filePaths[cacheIndex] = filePath;
+        m_activeCacheSlot = cacheIndex;
+        return fileDescriptor;
+    }
+
+    void StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        // Only requests that haven't been handed to the kernel can be canceled, in-flight reads
+        // will complete normally and release their slot.
+        for (auto it = m_pendingRequests.begin(); it != m_pendingRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingRequests.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(cancelRequest);
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+        size_t cacheIndex = FindFileInCache(fileExists.m_path);
+        if (cacheIndex != s_fileNotFound)
+        {
+            fileExists.m_found = true;
+        }
+        else
+        {
+            fileExists.m_found = SystemFile::Exists(fileExists.m_path.GetAbsolutePath());
+        }
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataTimeAverage);
+
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+        u64 size = SystemFile::Length(command.m_path.GetAbsolutePath());
+        if (size != 0) // SystemFile::Length doesn't allow telling a zero-sized file apart from a invalid path.
+        {
+            command.m_fileSize = size;
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        }
+        else
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+        }
+
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        size_t cacheIndex = FindFileInCache(filePath);
+        if (cacheIndex != s_fileNotFound)
+        {
+            m_fileLastUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+            if (m_fileDescriptors[cacheIndex] >= 0)
+            {
+                close(m_fileDescriptors[cacheIndex]);
+                m_fileDescriptors[cacheIndex] = -1;
+            }
+            m_filePaths[cacheIndex].Clear();
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        size_t numFiles = m_filePaths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            m_fileLastUsed[i] = AZStd::chrono::system_clock::time_point();
+            if (m_fileDescriptors[i] >= 0)
+            {
+                close(m_fileDescriptors[i]);
+                m_fileDescriptors[i] = -1;
+            }
+            m_filePaths[i].Clear();
+        }
+    }
+
+    size_t StorageDriveLinux::FindFileInCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_filePaths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_filePaths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return s_fileNotFound;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        constexpr double bytesToMB = (1024.0 * 1024.0);
+        using DoubleSeconds = AZStd::chrono::duration<double>;
+
+        double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+        double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+        if (m_readSizeAverage.GetTotal() > 1) // A default value is always added.
+        {
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+        }
+
+        if (m_fileOpenCloseTimeAverage.GetNumRecorded() > 0)
+        {
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", aznumeric_cast<s64>(m_freeSlots.size()) - m_pendingRequests.size()));
+        }
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            for (u32 i = 0; i < m_fileDescriptors.size(); ++i)
+            {
+                if (m_fileDescriptors[i] >= 0)
+                {
+                    AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_filePaths[i].GetRelativePath());
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <sys/uio.h>
+
+namespace AZ::IO
+{
+    namespace Platform
+    {
+        //! Thin wrapper around the io_uring kernel interface using raw syscalls so no dependency
+        //! on liburing is needed. Only the subset needed by the Streamer storage drive is exposed.
+        class IoUring final
+        {
+        public:
+            IoUring() = default;
+            ~IoUring();
+
+            IoUring(const IoUring&) = delete;
+            IoUring& operator=(const IoUring&) = delete;
+
+            //! Creates the ring with the requested number of submission entries.
+            //! Returns false if the kernel doesn't support io_uring.
+            bool Create(AZ::u32 queueDepth);
+            bool IsValid() const { return m_ringFd >= 0; }
+
+            //! Queues a vectored read on the submission ring. Returns false if the ring is full.
+            bool QueueRead(int fileDescriptor, iovec* vec, AZ::u64 offset, void* userData);
+            //! Submits all queued reads to the kernel with a single syscall.
+            //! Returns the number of submitted entries.
+            AZ::u32 Submit();
+            //! Pops a single completion if one is available. Returns false if the completion ring is empty.
+            bool PopCompletion(void** userData, AZ::s32& result);
+
+        private:
+            void Destroy();
+
+            // Submission queue bookkeeping, pointers map into the kernel shared rings.
+            void* m_sqRing = nullptr;
+            void* m_cqRing = nullptr;
+            size_t m_sqRingSize = 0;
+            size_t m_cqRingSize = 0;
+            struct io_uring_sqe* m_sqes = nullptr;
+            size_t m_sqesSize = 0;
+
+            AZ::u32* m_sqHead = nullptr;
+            AZ::u32* m_sqTail = nullptr;
+            AZ::u32* m_sqMask = nullptr;
+            AZ::u32* m_sqArray = nullptr;
+            AZ::u32* m_cqHead = nullptr;
+            AZ::u32* m_cqTail = nullptr;
+            AZ::u32* m_cqMask = nullptr;
+            struct io_uring_cqe* m_cqes = nullptr;
+
+            AZ::u32 m_pendingSubmissions = 0;
+            int m_ringFd = -1;
+        };
+    } // namespace Platform
+
+    //! Storage drive for Linux that issues reads through io_uring instead of performing
+    //! blocking reads on the scheduling thread. Multiple reads are kept in flight at the
+    //! same time so the kernel and device can reorder and overlap them, while completions
+    //! are reaped without blocking the scheduler.
+    class StorageDriveLinux final
+        : public StreamStackEntry
+    {
+    public:
+        //! Checks whether the running kernel supports io_uring.
+        static bool IsIoUringSupported();
+
+        StorageDriveLinux(u32 maxFileHandles, u32 queueDepth);
+        ~StorageDriveLinux() override;
+
+        void SetNext(AZStd::shared_ptr<StreamStackEntry> next) override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    private:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        //! A read that has been handed to the kernel and is awaiting completion.
+        struct InFlightRead
+        {
+            FileRequest* m_request = nullptr;
+            iovec m_vec{};
+        };
+
+        size_t FindFileInCache(const RequestPath& filePath) const;
+        int OpenFile(const RequestPath& filePath);
+        bool IssueRead(FileRequest* request);
+        void ReapCompletions(bool& workDone);
+        void CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+
+        Platform::IoUring m_ring;
+
+        //! File requests that are waiting for a free submission slot.
+        AZStd::deque<FileRequest*> m_pendingRequests;
+        //! Fixed pool of in-flight slots, the free entries are tracked by index in m_freeSlots.
+        AZStd::vector<InFlightRead> m_inFlight;
+        AZStd::vector<u32> m_freeSlots;
+
+        //! The last time a file handle was used to access a file. The handle is stored in m_fileDescriptors.
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileLastUsed;
+        //! The file path to the file handle. The handle is stored in m_fileDescriptors.
+        AZStd::vector<RequestPath> m_filePaths;
+        //! A list of file descriptors that's being cached in case they're needed again in the future.
+        AZStd::vector<int> m_fileDescriptors;
+
+        //! The offset into the file of the last issued read, used for seek estimates.
+        u64 m_activeOffset = 0;
+        //! The index into m_fileDescriptors for the file that's currently being read.
+        size_t m_activeCacheSlot = s_fileNotFound;
+
+        u32 m_queueDepth = 0;
+    };
+} // namespace AZ::IO
@@ -10,6 +10,7 @@
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/containers/lock_free_queue.h>
+#include <AzCore/std/parallel/containers/lock_free_ring_queue.h>
 #include <AzCore/std/parallel/containers/lock_free_stamped_queue.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
@@ -41,6 +42,19 @@ namespace UnitTest
             }
         }
 
+        //push for bounded queues, retries until the push succeeds
+        template <class Q>
+        void PushBounded(Q* queue)
+        {
+            for (int i = 0; i < NUM_ITERATIONS; ++i)
+            {
+                while (!queue->push(i))
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
         template <class Q>
         void Pop(Q* queue)
         {
@@ -150,6 +164,94 @@ namespace UnitTest
         }
     }
 
+    TEST_F(LockFreeQueue, LockFreeRingQueue)
+    {
+        {
+            //capacity is rounded up to the next power of two
+            lock_free_ring_queue<int> roundedQueue(100);
+            AZ_TEST_ASSERT(roundedQueue.capacity() == 128);
+        }
+
+        lock_free_ring_queue<int> queue(4);
+        int result;
+        AZ_TEST_ASSERT(queue.capacity() == 4);
+        AZ_TEST_ASSERT(queue.empty());
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        AZ_TEST_ASSERT(queue.push(20));
+        AZ_TEST_ASSERT(!queue.empty());
+        AZ_TEST_ASSERT(queue.pop(&result));
+        AZ_TEST_ASSERT(result == 20);
+        AZ_TEST_ASSERT(queue.empty());
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        //a full queue must reject the push and recover once a slot is freed
+        AZ_TEST_ASSERT(queue.push(1));
+        AZ_TEST_ASSERT(queue.push(2));
+        AZ_TEST_ASSERT(queue.push(3));
+        AZ_TEST_ASSERT(queue.push(4));
+        AZ_TEST_ASSERT(!queue.push(5));
+        AZ_TEST_ASSERT(queue.pop(&result));
+        AZ_TEST_ASSERT(result == 1);
+        AZ_TEST_ASSERT(queue.push(5));
+        for (int expected = 2; expected <= 5; ++expected)
+        {
+            AZ_TEST_ASSERT(queue.pop(&result));
+            AZ_TEST_ASSERT(result == expected);
+        }
+        AZ_TEST_ASSERT(queue.empty());
+
+        {
+            m_counter = 0;
+            AZStd::thread thread0(AZStd::bind(&LockFreeQueue::PushBounded<decltype(queue)>, this, &queue));
+            AZStd::thread thread1(AZStd::bind(&LockFreeQueue::Pop<decltype(queue)>, this, &queue));
+            thread0.join();
+            thread1.join();
+            AZ_TEST_ASSERT(m_counter == NUM_ITERATIONS);
+            AZ_TEST_ASSERT(queue.empty());
+        }
+    }
+
+    TEST_F(LockFreeQueue, LockFreeRingQueueNonTrivialDestructor)
+    {
+        lock_free_ring_queue<SharedInt> queue(4);
+        SharedInt result;
+        AZ_TEST_ASSERT(queue.empty());
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        AZ_TEST_ASSERT(queue.push(20));
+        AZ_TEST_ASSERT(!queue.empty());
+        AZ_TEST_ASSERT(queue.pop(&result));
+        AZ_TEST_ASSERT(result == 20);
+        AZ_TEST_ASSERT(queue.empty());
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        AZ_TEST_ASSERT(queue.push(20));
+        AZ_TEST_ASSERT(queue.push(30));
+        AZ_TEST_ASSERT(!queue.empty());
+        AZ_TEST_ASSERT(queue.pop(&result));
+        AZ_TEST_ASSERT(result == 20);
+        AZ_TEST_ASSERT(!queue.empty());
+        AZ_TEST_ASSERT(queue.pop(&result));
+        AZ_TEST_ASSERT(result == 30);
+        AZ_TEST_ASSERT(queue.empty());
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        {
+            m_counter = 0;
+            AZStd::thread thread0(AZStd::bind(&LockFreeQueue::PushBounded<decltype(queue)>, this, &queue));
+            AZStd::thread thread1(AZStd::bind(&LockFreeQueue::Pop<decltype(queue)>, this, &queue));
+            thread0.join();
+            thread1.join();
+            AZ_TEST_ASSERT(m_counter == NUM_ITERATIONS);
+            AZ_TEST_ASSERT(queue.empty());
+        }
+
+        //values still in the queue when it is destroyed must be released
+        queue.push(40);
+        queue.push(50);
+    }
+
     TEST_F(LockFreeQueue, LockFreeStampedQueue)
     {
         lock_free_stamped_queue<int, MyLockFreeAllocator> queue;
@@ -225,3 +327,77 @@ namespace UnitTest
         }
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    static constexpr size_t RingQueueCapacity = 4096;
+
+    static void BM_LockFreeQueuePerf_PushPop(benchmark::State& state)
+    {
+        AZStd::lock_free_queue<int, UnitTestInternal::MyLockFreeAllocator> queue;
+        int value;
+        while (state.KeepRunning())
+        {
+            queue.push(1);
+            queue.pop(&value);
+        }
+        benchmark::DoNotOptimize(value);
+    }
+    BENCHMARK(BM_LockFreeQueuePerf_PushPop);
+
+    static void BM_LockFreeRingQueuePerf_PushPop(benchmark::State& state)
+    {
+        AZStd::lock_free_ring_queue<int> queue(RingQueueCapacity);
+        int value;
+        while (state.KeepRunning())
+        {
+            queue.push(1);
+            queue.pop(&value);
+        }
+        benchmark::DoNotOptimize(value);
+    }
+    BENCHMARK(BM_LockFreeRingQueuePerf_PushPop);
+
+    static void BM_LockFreeRingQueuePerf_Contended(benchmark::State& state)
+    {
+        static AZStd::lock_free_ring_queue<int>* queue = nullptr;
+        if (state.thread_index == 0)
+        {
+            queue = new AZStd::lock_free_ring_queue<int>(RingQueueCapacity);
+        }
+
+        //odd threads produce, even threads consume, a thread drains its own push when its pop misses
+        //so the queue can't deadlock on an unbalanced thread count
+        int value;
+        while (state.KeepRunning())
+        {
+            if (state.thread_index & 1)
+            {
+                if (!queue->push(state.thread_index))
+                {
+                    queue->pop(&value);
+                }
+            }
+            else
+            {
+                if (!queue->pop(&value))
+                {
+                    queue->push(state.thread_index);
+                }
+            }
+        }
+
+        if (state.thread_index == 0)
+        {
+            delete queue;
+            queue = nullptr;
+        }
+    }
+    BENCHMARK(BM_LockFreeRingQueuePerf_Contended)->ThreadRange(2, 8);
+}
+
+#endif // HAVE_BENCHMARK
@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 
@@ -674,4 +675,37 @@ namespace UnitTest
         // the aabb is contained within the frustum
         EXPECT_TRUE(AZ::ShapeIntersection::Contains(viewFrustum, aabb));
     }
+
+    TEST(MATH_Frustum, TestIntersectAabbBatch)
+    {
+        // a mix of interior, overlapping and exterior boxes taken from the single box tests,
+        // deliberately not a multiple of four so the scalar tail is exercised too
+        AZStd::vector<AZ::Aabb> aabbs;
+        for (float y : { -10.0f, 0.0f, 2.0f, 10.0f, 50.0f, 99.0f, 101.0f, 150.0f, 1000.0f })
+        {
+            const AZ::Vector3 center(0.0f, y, 0.0f);
+            aabbs.push_back(AZ::Aabb::CreateFromMinMax(center - AZ::Vector3(0.5f), center + AZ::Vector3(0.5f)));
+            aabbs.push_back(AZ::Aabb::CreateFromMinMax(center - AZ::Vector3(1.5f), center + AZ::Vector3(1.5f)));
+            aabbs.push_back(AZ::Aabb::CreateFromMinMax(center - AZ::Vector3(25.0f), center + AZ::Vector3(25.0f)));
+        }
+        // boxes far off to the sides to trigger the bounding sphere block rejection
+        for (float x : { -1000.0f, 1000.0f })
+        {
+            for (float y : { -8.0f, -4.0f, 4.0f, 8.0f })
+            {
+                const AZ::Vector3 center(x, y, 0.0f);
+                aabbs.push_back(AZ::Aabb::CreateFromMinMax(center - AZ::Vector3(1.0f), center + AZ::Vector3(1.0f)));
+            }
+        }
+
+        for (const AZ::Frustum& frustum : { testFrustum1, testFrustum2 })
+        {
+            AZStd::vector<AZ::IntersectResult> results(aabbs.size(), AZ::IntersectResult::Overlaps);
+            frustum.IntersectAabbBatch(aabbs, results);
+            for (size_t i = 0; i < aabbs.size(); ++i)
+            {
+                EXPECT_EQ(results[i], frustum.IntersectAabb(aabbs[i])) << "aabb index " << i;
+            }
+        }
+    }
 } // namespace UnitTest
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/TransformBatch.h>
+#include <AzCore/std/containers/vector.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    class TransformBatchFixture
+        : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            // a mix of rotation, non-unit scale and translation so all transform components contribute
+            m_transforms.push_back(AZ::Transform::CreateIdentity());
+            m_transforms.push_back(AZ::Transform::CreateRotationX(AZ::Constants::QuarterPi));
+            m_transforms.push_back(AZ::Transform::CreateTranslation(AZ::Vector3(0.8f, 2.3f, -1.9f)));
+            m_transforms.push_back(AZ::Transform(AZ::Vector3(-2.4f, 0.9f, 11.3f),
+                AZ::Quaternion::CreateRotationZ(0.7f) * AZ::Quaternion::CreateRotationY(-1.2f), 2.5f));
+            m_transforms.push_back(AZ::Transform(AZ::Vector3(100.0f, -5.0f, 0.25f),
+                AZ::Quaternion::CreateRotationX(2.9f), 0.1f));
+
+            m_points.push_back(AZ::Vector3::CreateZero());
+            m_points.push_back(AZ::Vector3(1.0f, 2.0f, 3.0f));
+            m_points.push_back(AZ::Vector3(-12.4f, 0.03f, 8.1f));
+            m_points.push_back(AZ::Vector3(1000.0f, -950.0f, 123.4f));
+            m_points.push_back(AZ::Vector3(0.001f, -0.002f, 0.003f));
+            m_points.push_back(AZ::Vector3(-7.7f, 5.5f, -3.3f));
+        }
+
+        AZStd::vector<AZ::Transform> m_transforms;
+        AZStd::vector<AZ::Vector3> m_points;
+    };
+
+    TEST_F(TransformBatchFixture, MultiplyArray_MatchesPerElementMultiply)
+    {
+        const size_t count = m_transforms.size();
+        AZStd::vector<AZ::Transform> reversed(m_transforms.rbegin(), m_transforms.rend());
+        AZStd::vector<AZ::Transform> result(count);
+
+        AZ::TransformBatch::MultiplyArray(m_transforms.data(), reversed.data(), result.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_THAT(result[i], IsClose(m_transforms[i] * reversed[i]));
+        }
+    }
+
+    TEST_F(TransformBatchFixture, MultiplyArray_FixedParent_MatchesPerElementMultiply)
+    {
+        const size_t count = m_transforms.size();
+        const AZ::Transform parent = m_transforms.back();
+        AZStd::vector<AZ::Transform> result(count);
+
+        AZ::TransformBatch::MultiplyArray(parent, m_transforms.data(), result.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_THAT(result[i], IsClose(parent * m_transforms[i]));
+        }
+    }
+
+    TEST_F(TransformBatchFixture, InverseArray_MultipliesBackToIdentity)
+    {
+        const size_t count = m_transforms.size();
+        AZStd::vector<AZ::Transform> inverses(count);
+
+        AZ::TransformBatch::InverseArray(m_transforms.data(), inverses.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_THAT(m_transforms[i] * inverses[i], IsClose(AZ::Transform::CreateIdentity()));
+        }
+    }
+
+    TEST_F(TransformBatchFixture, InverseArray_InPlace)
+    {
+        AZStd::vector<AZ::Transform> transforms = m_transforms;
+        AZ::TransformBatch::InverseArray(transforms.data(), transforms.data(), transforms.size());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            EXPECT_THAT(transforms[i], IsClose(m_transforms[i].GetInverse()));
+        }
+    }
+
+    TEST_F(TransformBatchFixture, TransformPointArray_MatchesTransformPoint)
+    {
+        const size_t count = m_points.size();
+        AZStd::vector<AZ::Vector3> result(count);
+
+        for (const AZ::Transform& transform : m_transforms)
+        {
+            AZ::TransformBatch::TransformPointArray(transform, m_points.data(), result.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_THAT(result[i], IsCloseTolerance(transform.TransformPoint(m_points[i]), 1e-3f));
+            }
+        }
+    }
+
+    TEST_F(TransformBatchFixture, TransformPointArraySoa_MatchesTransformPoint)
+    {
+        const size_t count = m_points.size();
+        AZStd::vector<float> x(count), y(count), z(count);
+        AZStd::vector<float> resultX(count), resultY(count), resultZ(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            x[i] = m_points[i].GetX();
+            y[i] = m_points[i].GetY();
+            z[i] = m_points[i].GetZ();
+        }
+
+        for (const AZ::Transform& transform : m_transforms)
+        {
+            // count is deliberately not a multiple of four so both the vectorized loop and
+            // the scalar tail run
+            AZ::TransformBatch::TransformPointArraySoa(transform,
+                x.data(), y.data(), z.data(), resultX.data(), resultY.data(), resultZ.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const AZ::Vector3 expected = transform.TransformPoint(m_points[i]);
+                EXPECT_THAT(AZ::Vector3(resultX[i], resultY[i], resultZ[i]), IsCloseTolerance(expected, 1e-3f));
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class FrameAllocatorTest
+        : public ::testing::Test
+    {
+    };
+
+    TEST_F(FrameAllocatorTest, Allocate_RespectsAlignment)
+    {
+        ScopedArenaMark scope;
+
+        for (size_t alignment : { size_t{ 1 }, size_t{ 4 }, size_t{ 16 }, size_t{ 64 }, size_t{ 128 } })
+        {
+            void* memory = FrameAllocator::Allocate(24, alignment);
+            EXPECT_NE(memory, nullptr);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) & (alignment - 1), 0);
+        }
+    }
+
+    TEST_F(FrameAllocatorTest, ScopedArenaMark_RewindsAllocations)
+    {
+        ScopedArenaMark outerScope;
+        size_t outerSize = FrameAllocator::GetAllocatedSize();
+
+        FrameAllocator::Allocate(64, 16);
+        size_t sizeAfterOuterAllocation = FrameAllocator::GetAllocatedSize();
+        EXPECT_GT(sizeAfterOuterAllocation, outerSize);
+
+        {
+            ScopedArenaMark innerScope;
+            FrameAllocator::Allocate(1024, 16);
+            FrameAllocator::Allocate(1024, 16);
+            EXPECT_GT(FrameAllocator::GetAllocatedSize(), sizeAfterOuterAllocation);
+        }
+
+        // the inner scope rewound its own allocations but not the outer one
+        EXPECT_EQ(FrameAllocator::GetAllocatedSize(), sizeAfterOuterAllocation);
+    }
+
+    TEST_F(FrameAllocatorTest, Allocate_LargerThanArena_FallsBackToOsHeap)
+    {
+        ScopedArenaMark scope;
+
+        // far larger than the arena, so it can't be serviced by the bump pointer
+        constexpr size_t oversized = 4 * FrameAllocator::DefaultArenaCapacity;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        void* memory = FrameAllocator::Allocate(oversized, 16);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_NE(memory, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) & 15, 0);
+
+        // the memory is writable and released by the scope's rewind
+        memset(memory, 0xcd, oversized);
+    }
+
+    TEST_F(FrameAllocatorTest, FrameStdAllocator_BacksContainers)
+    {
+        ScopedArenaMark scope;
+        size_t startSize = FrameAllocator::GetAllocatedSize();
+
+        {
+            AZStd::vector<int, FrameStdAllocator> values;
+            for (int i = 0; i < 100; ++i)
+            {
+                values.push_back(i);
+            }
+            for (int i = 0; i < 100; ++i)
+            {
+                EXPECT_EQ(values[i], i);
+            }
+            EXPECT_GT(FrameAllocator::GetAllocatedSize(), startSize);
+        }
+
+        // the vector's destructor doesn't return memory, the enclosing scope does
+        EXPECT_GT(FrameAllocator::GetAllocatedSize(), startSize);
+    }
+
+    TEST_F(FrameAllocatorTest, ThreadArenas_AreIndependent)
+    {
+        ScopedArenaMark scope;
+        size_t mainThreadSize = FrameAllocator::GetAllocatedSize();
+
+        AZStd::thread worker(
+            []()
+            {
+                EXPECT_EQ(FrameAllocator::GetAllocatedSize(), 0);
+                FrameAllocator::Allocate(256, 16);
+                EXPECT_GE(FrameAllocator::GetAllocatedSize(), 256);
+                FrameAllocator::Reset();
+                EXPECT_EQ(FrameAllocator::GetAllocatedSize(), 0);
+            });
+        worker.join();
+
+        EXPECT_EQ(FrameAllocator::GetAllocatedSize(), mainThreadSize);
+    }
+}
@@ -48,14 +48,25 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        //! Gathers the entries of every dictionary shard into a single map for inspection.
+        static AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> GetDictionary()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> combinedDictionary;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                combinedDictionary.insert(shard.m_dictionary.begin(), shard.m_dictionary.end());
+            }
+            return combinedDictionary;
         }
-        
+
         static size_t GetEntryCount()
         {
-            return GetDictionary().size();
+            size_t entryCount = 0;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                entryCount += shard.m_dictionary.size();
+            }
+            return entryCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -280,7 +291,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
+            auto globalDictionary = NameDictionaryTester::GetDictionary();
             auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
                 return entry.second->GetName() == nameString;
             });
@@ -367,6 +378,19 @@ namespace UnitTest
         EXPECT_EQ(0, emptyName.GetStringView().data()[0]);
     }
 
+    TEST_F(NameTest, NameLiteralMatchesRuntimeHashedName)
+    {
+        // The macro's hash is computed at compile time and must agree with the runtime hashing path
+        static_assert(AZ::NameDictionary::CalcHash("literalName") == AZ::NameDictionary::CalcHash(AZStd::string_view("literalName")));
+
+        AZ::Name fromLiteral = AZ_NAME_LITERAL("literalName");
+        AZ::Name fromString{"literalName"};
+        EXPECT_EQ(fromLiteral, fromString);
+        EXPECT_EQ(fromLiteral.GetHash(), fromString.GetHash());
+        EXPECT_EQ(fromLiteral.GetStringView(), "literalName");
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
     TEST_F(NameTest, EmptyNameIsNotInDictionary)
     {
         EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
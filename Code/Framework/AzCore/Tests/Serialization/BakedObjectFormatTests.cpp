@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Serialization/BakedObjectFormat.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    struct BakedTestObject
+    {
+        AZ_TYPE_INFO(BakedTestObject, "{9B8E36E7-1A12-4B8B-8D36-0C5B45A4BEE1}");
+
+        static constexpr uint32_t LayoutVersion = 3;
+
+        uint64_t m_value = 0;
+        const uint64_t* m_pointerIntoPayload = nullptr;
+    };
+
+    class BakedObjectFormatTest
+        : public ScopedAllocatorSetupFixture
+    {
+    };
+
+    TEST_F(BakedObjectFormatTest, WriteAndPatch_RoundTripsObjectWithInternalPointer)
+    {
+        // Bake an object followed by a data block, with the object's pointer stored as an offset
+        BakedTestObject object;
+        object.m_value = 0x1234;
+
+        AZ::BakedObjectWriter writer(AZ::AzTypeInfo<BakedTestObject>::Uuid(), BakedTestObject::LayoutVersion);
+        const uint64_t objectOffset = writer.AppendBytes(&object, sizeof(object), alignof(BakedTestObject));
+        const uint64_t pointedAtValue = 0x5678;
+        const uint64_t dataOffset = writer.AppendBytes(&pointedAtValue, sizeof(pointedAtValue), alignof(uint64_t));
+        writer.AddRelocation(objectOffset + offsetof(BakedTestObject, m_pointerIntoPayload), dataOffset);
+
+        AZStd::vector<uint8_t> image;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> stream(&image);
+        EXPECT_TRUE(writer.Write(stream));
+
+        BakedTestObject* patched = AZ::BakedObjectLoader::PatchInPlace<BakedTestObject>(
+            image.data(), image.size(), BakedTestObject::LayoutVersion);
+        ASSERT_NE(patched, nullptr);
+        EXPECT_EQ(patched->m_value, 0x1234);
+        ASSERT_NE(patched->m_pointerIntoPayload, nullptr);
+        EXPECT_EQ(*patched->m_pointerIntoPayload, 0x5678);
+    }
+
+    TEST_F(BakedObjectFormatTest, PatchInPlace_RejectsMismatchedTypeAndLayoutVersion)
+    {
+        BakedTestObject object;
+        AZ::BakedObjectWriter writer(AZ::AzTypeInfo<BakedTestObject>::Uuid(), BakedTestObject::LayoutVersion);
+        writer.AppendBytes(&object, sizeof(object), alignof(BakedTestObject));
+
+        AZStd::vector<uint8_t> image;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> stream(&image);
+        EXPECT_TRUE(writer.Write(stream));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        // Wrong layout version must fail so callers fall back to ObjectStream
+        EXPECT_EQ(AZ::BakedObjectLoader::PatchInPlace<BakedTestObject>(image.data(), image.size(), BakedTestObject::LayoutVersion + 1), nullptr);
+        // Wrong type must fail
+        EXPECT_EQ(AZ::BakedObjectLoader::PatchInPlace(image.data(), image.size(), AZ::Uuid::CreateRandom(), BakedTestObject::LayoutVersion), nullptr);
+        // Truncated image must fail
+        EXPECT_EQ(AZ::BakedObjectLoader::PatchInPlace<BakedTestObject>(image.data(), sizeof(AZ::BakedObjectHeader) - 1, BakedTestObject::LayoutVersion), nullptr);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(3);
+    }
+
+    TEST_F(BakedObjectFormatTest, SupportsBakedObjectFormat_ReflectsClassAttributeOptIn)
+    {
+        AZ::SerializeContext serializeContext;
+        serializeContext.Class<BakedTestObject>()
+            ->Attribute(AZ::BakedObjectFormatAttribute, BakedTestObject::LayoutVersion);
+
+        uint32_t layoutVersion = 0;
+        EXPECT_TRUE(AZ::SupportsBakedObjectFormat(serializeContext, AZ::AzTypeInfo<BakedTestObject>::Uuid(), layoutVersion));
+        EXPECT_EQ(layoutVersion, BakedTestObject::LayoutVersion);
+
+        // Types without the attribute keep using ObjectStream
+        EXPECT_FALSE(AZ::SupportsBakedObjectFormat(serializeContext, AZ::Uuid::CreateRandom(), layoutVersion));
+    }
+}
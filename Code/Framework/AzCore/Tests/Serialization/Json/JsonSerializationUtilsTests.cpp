@@ -294,6 +294,44 @@ namespace UnitTest
         EXPECT_TRUE(result.GetError().find("JSON parse error at line 5:") == 0);
     }
     
+    TEST_F(JsonSerializationUtilsTests, ReadJsonStreamInSitu_StringsAliasBuffer)
+    {
+        const char* jsonText =
+            R"(
+            {
+                "a": 1,
+                "name": "InSituValue"
+            })";
+
+        IO::MemoryStream stream(jsonText, strlen(jsonText));
+
+        auto result = JsonSerializationUtils::ReadJsonStreamInSitu(stream);
+
+        ASSERT_TRUE(result.IsSuccess());
+        JsonSerializationUtils::InSituJsonDocument& parsed = result.GetValue();
+        EXPECT_TRUE(parsed.m_document.IsObject());
+        EXPECT_EQ(parsed.m_document["a"].GetInt(), 1);
+        ASSERT_TRUE(parsed.m_document["name"].IsString());
+        EXPECT_STREQ(parsed.m_document["name"].GetString(), "InSituValue");
+
+        // In-situ parsing stores string values inside the original text buffer instead of
+        // copying them into the document allocator.
+        const char* stringValue = parsed.m_document["name"].GetString();
+        EXPECT_GE(stringValue, parsed.m_jsonText.data());
+        EXPECT_LT(stringValue, parsed.m_jsonText.data() + parsed.m_jsonText.size());
+    }
+
+    TEST_F(JsonSerializationUtilsTests, ReadJsonTextInSitu_ParseError_ReportsFailure)
+    {
+        const char* jsonText = "Not a Json";
+        AZStd::vector<char> buffer(jsonText, jsonText + strlen(jsonText));
+
+        auto result = JsonSerializationUtils::ReadJsonTextInSitu(AZStd::move(buffer));
+
+        EXPECT_FALSE(result.IsSuccess());
+        EXPECT_TRUE(result.GetError().find("JSON parse error") == 0);
+    }
+
     TEST_F(JsonSerializationUtilsTests, LoadObjectFromStream_Failed_ParseError)
     {
         char buffer[1024] = "Not a Json";
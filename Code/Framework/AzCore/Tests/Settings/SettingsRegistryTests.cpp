@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -685,6 +686,62 @@ namespace SettingsRegistryTests
     // Note: The typed tests already test several GetType versions.
     //
 
+    TEST_F(SettingsRegistryTest, Snapshot_SaveAndLoad_RestoresMergedSettings)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(
+            R"({ "Object": { "Boolean": true, "Integer": 42, "Double": 42.5, "String": "Hello", "Array": [ 1, 2, 3 ], "Null": null } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::vector<AZ::u8> snapshot;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&snapshot);
+        ASSERT_TRUE(m_registry->SaveSnapshot(stream));
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        ASSERT_TRUE(loadedRegistry.LoadSnapshot(snapshot.data(), snapshot.size()));
+
+        bool boolValue{};
+        EXPECT_TRUE(loadedRegistry.Get(boolValue, "/Object/Boolean"));
+        EXPECT_TRUE(boolValue);
+        AZ::s64 intValue{};
+        EXPECT_TRUE(loadedRegistry.Get(intValue, "/Object/Integer"));
+        EXPECT_EQ(intValue, 42);
+        double doubleValue{};
+        EXPECT_TRUE(loadedRegistry.Get(doubleValue, "/Object/Double"));
+        EXPECT_EQ(doubleValue, 42.5);
+        AZStd::string stringValue;
+        EXPECT_TRUE(loadedRegistry.Get(stringValue, "/Object/String"));
+        EXPECT_EQ(stringValue, "Hello");
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, loadedRegistry.GetType("/Object/Array"));
+        EXPECT_TRUE(loadedRegistry.Get(intValue, "/Object/Array/2"));
+        EXPECT_EQ(intValue, 3);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, loadedRegistry.GetType("/Object/Null"));
+
+        // Dynamic overrides still merge on top of the snapshot
+        ASSERT_TRUE(loadedRegistry.MergeSettings(R"({ "Object": { "Integer": 88 } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_TRUE(loadedRegistry.Get(intValue, "/Object/Integer"));
+        EXPECT_EQ(intValue, 88);
+        EXPECT_TRUE(loadedRegistry.Get(stringValue, "/Object/String"));
+        EXPECT_EQ(stringValue, "Hello");
+    }
+
+    TEST_F(SettingsRegistryTest, Snapshot_LoadCorruptData_ReportsErrorAndKeepsRegistryUsable)
+    {
+        AZStd::vector<AZ::u8> snapshot;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&snapshot);
+        ASSERT_TRUE(m_registry->SaveSnapshot(stream));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        // Too small to hold the header
+        EXPECT_FALSE(m_registry->LoadSnapshot(snapshot.data(), 4));
+        // Truncated payload
+        EXPECT_FALSE(m_registry->LoadSnapshot(snapshot.data(), snapshot.size() - 1));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+
+        // The registry can still be written to after a rejected snapshot
+        EXPECT_TRUE(m_registry->Set("/Object/Value", aznumeric_cast<AZ::s64>(42)));
+    }
+
     TEST_F(SettingsRegistryTest, GetType_TypeForObject_TypeMatchesProvidedType)
     {
         ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 42 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
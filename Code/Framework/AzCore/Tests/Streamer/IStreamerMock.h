@@ -44,6 +44,7 @@ public:
     MOCK_METHOD1(QueueRequest, void(const FileRequestPtr&));
     MOCK_METHOD1(QueueRequestBatch, void(const AZStd::vector<FileRequestPtr>&));
     MOCK_METHOD1(QueueRequestBatch, void(AZStd::vector<FileRequestPtr>&&));
+    MOCK_METHOD1(QueueRequestBatch, void(AZStd::span<const FileRequestPtr>));
     MOCK_CONST_METHOD1(HasRequestCompleted, bool(FileRequestHandle));
     MOCK_CONST_METHOD1(GetRequestStatus, IStreamerTypes::RequestStatus(FileRequestHandle));
     MOCK_CONST_METHOD1(GetEstimatedRequestCompletionTime, AZStd::chrono::system_clock::time_point(FileRequestHandle));
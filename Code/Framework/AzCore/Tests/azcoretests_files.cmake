@@ -91,6 +91,7 @@ set(FILES
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
+    Serialization/BakedObjectFormatTests.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/BaseJsonSerializerFixture.h
     Serialization/Json/BaseJsonSerializerTests.cpp
@@ -163,6 +164,7 @@ set(FILES
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/SplineTests.cpp
+    Math/TransformBatchTests.cpp
     Math/TransformPerformanceTests.cpp
     Math/TransformTests.cpp
     Math/Vector2PerformanceTests.cpp
@@ -173,6 +175,7 @@ set(FILES
     Math/Vector4Tests.cpp
     Memory/AllocatorBenchmarks.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
@@ -105,6 +105,27 @@ namespace Physics
         //! Returns the list of heights and materials used by the height field.
         //! @return the rows*columns vector of the heights and materials.
         virtual AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const = 0;
+
+        //! Returns the range of sample indices affected by the given world space dirty region.
+        //! The range is expanded by one sample at the start of each dimension because the material indices of the
+        //! bordering quads refer to the modified samples.
+        //! @param dirtyRegion the world space AABB of the modified data.
+        //! @param startColumn contains the first affected column index.
+        //! @param startRow contains the first affected row index.
+        //! @param numColumns contains the number of affected columns. Will be 0 if the region doesn't overlap the heightfield.
+        //! @param numRows contains the number of affected rows. Will be 0 if the region doesn't overlap the heightfield.
+        virtual void GetHeightfieldIndicesFromRegion(
+            const AZ::Aabb& dirtyRegion, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const = 0;
+
+        //! Returns the updated list of heights for the given world space dirty region.
+        //! @param dirtyRegion the world space AABB of the modified data.
+        //! @return the heights for the sample range returned by GetHeightfieldIndicesFromRegion, in row major order.
+        virtual AZStd::vector<float> UpdateHeights(const AZ::Aabb& dirtyRegion) const = 0;
+
+        //! Returns the updated list of heights and materials for the given world space dirty region.
+        //! @param dirtyRegion the world space AABB of the modified data.
+        //! @return the heights and materials for the sample range returned by GetHeightfieldIndicesFromRegion, in row major order.
+        virtual AZStd::vector<Physics::HeightMaterialPoint> UpdateHeightsAndMaterials(const AZ::Aabb& dirtyRegion) const = 0;
     };
 
     using HeightfieldProviderRequestsBus = AZ::EBus<HeightfieldProviderRequests>;
@@ -117,7 +138,8 @@ namespace Physics
         static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
 
         //! Called whenever the heightfield data changes.
-        //! @param the AABB of the area of data that changed.
+        //! @param the AABB of the area of data that changed. An invalid AABB means that the heightfield structure
+        //! itself (size, resolution or transform) may have changed and the entire heightfield should be rebuilt.
         virtual void OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
         {
         }
@@ -20,6 +20,7 @@ namespace AzFramework
     {
         typedef AZStd::function<void(size_t xIndex, size_t yIndex, const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)> SurfacePointRegionFillCallback;
         typedef AZStd::function<void(const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)> SurfacePointListFillCallback;
+        typedef AZStd::function<void()> QueryCompletionCallback;
 
         //! Shared interface for terrain system implementations
         class TerrainDataRequests
@@ -161,6 +162,22 @@ namespace AzFramework
                 SurfacePointListFillCallback perPositionCallback,
                 Sampler sampleFilter = Sampler::DEFAULT) const = 0;
 
+            //! Asynchronous version of ProcessHeightsFromList. The query is split up and processed on job manager threads, so
+            //! perPositionCallback can get called concurrently from multiple threads and must be thread safe. There is no guaranteed
+            //! ordering of the callbacks relative to the input list. onCompleteCallback is called once from a job thread after every
+            //! position has been processed. The default implementation processes the list synchronously before signaling completion.
+            virtual void QueryListAsync(const AZStd::span<AZ::Vector3>& inPositions,
+                SurfacePointListFillCallback perPositionCallback,
+                QueryCompletionCallback onCompleteCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const
+            {
+                ProcessHeightsFromList(inPositions, perPositionCallback, sampleFilter);
+                if (onCompleteCallback)
+                {
+                    onCompleteCallback();
+                }
+            }
+
             //! Returns the number of samples for a given region and step size. The first and second
             //! elements of the pair correspond to the X and Y sample counts respectively.
             virtual AZStd::pair<size_t, size_t> GetNumSamplesFromRegion(const AZ::Aabb& inRegion,
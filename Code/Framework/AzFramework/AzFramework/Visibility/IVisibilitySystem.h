@@ -72,6 +72,19 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Queue an entry for deferred insertion or update.
+        //! Unlike InsertOrUpdateEntry this is safe to call from multiple threads without taking the
+        //! scene lock, the entry is re-bucketed by the next ProcessDeferredEntries call. The entry's
+        //! bounding volume must stay valid until the queued update has been processed, and the entry
+        //! must not be destroyed before it has been removed through RemoveEntry.
+        //! Implementations without deferred support apply the update immediately.
+        //! @param visibilityEntry data for the object being added/updated
+        virtual void QueueInsertOrUpdateEntry(VisibilityEntry& visibilityEntry) { InsertOrUpdateEntry(visibilityEntry); }
+
+        //! Applies all entry updates queued through QueueInsertOrUpdateEntry.
+        //! Invoked once per frame by the visibility system, before render culling consumes the scene.
+        virtual void ProcessDeferredEntries() {}
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -16,6 +16,8 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeNodeBoundsFattenFactor, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Loose octree factor applied to node bounds when keeping moved entries bound to their node, 1 disables fattening. Applies to nodes created after the change");
+    AZ_CVAR(uint32_t, bg_octreeDirtyEntryQueueCapacity, 16384, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "Capacity of the per-scene queue of entries awaiting deferred re-bucketing; updates queued beyond this are applied immediately");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,14 +26,22 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    AZ::Aabb OctreeNode::CalculateLooseBounds(const AZ::Aabb& bounds)
+    {
+        const float fattenFactor = AZ::GetMax(static_cast<float>(bg_octreeNodeBoundsFattenFactor), 1.0f);
+        return bounds.GetExpanded(bounds.GetExtents() * (0.5f * (fattenFactor - 1.0f)));
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(CalculateLooseBounds(bounds))
     {
         ;
     }
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -46,6 +56,7 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -98,9 +109,10 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
         const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume))
         {
-            // Entry moved, but is still fully contained within the current node
+            // Entry moved, but is still fully contained within the current node's loose bounds,
+            // so small movements don't force a remove and re-insert
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
             return;
@@ -147,7 +159,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
         {
             EnumerateHelper(aabb, callback);
         }
@@ -155,7 +167,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
         {
             EnumerateHelper(sphere, callback);
         }
@@ -163,7 +175,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
         {
             EnumerateHelper(frustum, callback);
         }
@@ -172,9 +184,10 @@ namespace AzFramework
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
+        // The loose bounds are reported since entries are only guaranteed to be contained by them
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -233,12 +246,13 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
+        // The loose bounds are reported since entries are only guaranteed to be contained by them
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -247,7 +261,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -290,6 +304,7 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = CalculateLooseBounds(m_children[child].m_bounds);
                 m_children[child].m_parent = this;
             }
         }
@@ -329,6 +344,7 @@ namespace AzFramework
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
         : m_sceneName(sceneName)
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
+        , m_dirtyEntries(bg_octreeDirtyEntryQueueCapacity)
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
     }
@@ -351,6 +367,44 @@ namespace AzFramework
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryInternal(entry);
+    }
+
+    void OctreeScene::QueueInsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        // Queuing the same entry more than once per frame is allowed, the redundant updates are no-ops
+        if (!m_dirtyEntries.push(&entry))
+        {
+            // The queue is full, apply the update immediately rather than dropping it
+            InsertOrUpdateEntry(entry);
+        }
+    }
+
+    void OctreeScene::ProcessDeferredEntries()
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        ProcessDeferredEntriesInternal();
+    }
+
+    void OctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        // Drain any queued updates first so the queue can't hold a pointer to the removed entry
+        if (!m_dirtyEntries.empty())
+        {
+            ProcessDeferredEntriesInternal();
+        }
+
+        if (entry.m_internalNode)
+        {
+            static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
+            --m_entryCount;
+        }
+    }
+
+    void OctreeScene::InsertOrUpdateEntryInternal(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -362,13 +416,12 @@ namespace AzFramework
         }
     }
 
-    void OctreeScene::RemoveEntry(VisibilityEntry& entry)
+    void OctreeScene::ProcessDeferredEntriesInternal()
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
-        if (entry.m_internalNode)
+        VisibilityEntry* entry = nullptr;
+        while (m_dirtyEntries.pop(&entry))
         {
-            static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
-            --m_entryCount;
+            InsertOrUpdateEntryInternal(*entry);
         }
     }
 
@@ -539,12 +592,28 @@ namespace AzFramework
 
     void OctreeSystemComponent::Activate()
     {
-        ;
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void OctreeSystemComponent::Deactivate()
     {
-        ;
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    void OctreeSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_defaultScene->ProcessDeferredEntries();
+        for (OctreeScene* scene : m_scenes)
+        {
+            scene->ProcessDeferredEntries();
+        }
+    }
+
+    int OctreeSystemComponent::GetTickOrder()
+    {
+        // Process queued entry movement after game logic has updated positions, but before
+        // render-related handlers consume the visibility scenes for culling
+        return AZ::TICK_PRE_RENDER;
     }
 
     IVisibilityScene* OctreeSystemComponent::GetDefaultVisibilityScene()
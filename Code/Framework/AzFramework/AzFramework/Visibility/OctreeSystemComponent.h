@@ -11,9 +11,11 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/containers/lock_free_ring_queue.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
 namespace AzFramework
@@ -76,11 +78,16 @@ namespace AzFramework
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
+        //! Computes the fattened bounds used to keep entries bound to a node across small movements.
+        //! Controlled by the bg_octreeNodeBoundsFattenFactor cvar; a factor of 1 disables fattening.
+        static AZ::Aabb CalculateLooseBounds(const AZ::Aabb& bounds);
+
         // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        AZ::Aabb m_looseBounds; //< m_bounds fattened by the loose factor, entries are guaranteed to be contained by these bounds
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
@@ -103,6 +110,8 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void QueueInsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void ProcessDeferredEntries() override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
@@ -125,8 +134,17 @@ namespace AzFramework
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
+        //! Insert or update helpers that require m_sharedMutex to already be exclusively held.
+        //! @{
+        void InsertOrUpdateEntryInternal(VisibilityEntry& entry);
+        void ProcessDeferredEntriesInternal();
+        //! @}
+
         mutable AZStd::shared_mutex m_sharedMutex;
 
+        //! Entries queued for deferred re-bucketing, drained once per frame by ProcessDeferredEntries.
+        AZStd::lock_free_ring_queue<VisibilityEntry*> m_dirtyEntries;
+
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
 
@@ -148,6 +166,7 @@ namespace AzFramework
     class OctreeSystemComponent
         : public AZ::Component
         , public IVisibilitySystemRequestBus::Handler
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(OctreeSystemComponent, "{CD4FF1C5-BAF4-421D-951B-1E05DAEEF67B}");
@@ -168,6 +187,12 @@ namespace AzFramework
         void Deactivate() override;
         //! @}
 
+        //! AZ::TickBus::Handler overrides, applies queued entry updates for all scenes once per frame.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
         //! IVisibilitySystem overrides
         //! @{
         IVisibilityScene* GetDefaultVisibilityScene() override;
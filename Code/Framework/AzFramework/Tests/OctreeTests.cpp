@@ -420,4 +420,79 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
+
+    TEST_F(OctreeTests, DeferredInsertAndUpdate)
+    {
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.1f), AZ::Vector3(0.4f));
+
+        // Queued insertions are not applied until the deferred pass runs
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+
+        m_octreeScene->ProcessDeferredEntries();
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 1);
+
+        // Queued movement is applied by the deferred pass and visible to queries afterwards
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry);
+        m_octreeScene->ProcessDeferredEntries();
+
+        uint32_t hitCount = 0;
+        auto countHits = [&hitCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            hitCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+        };
+        m_octreeScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(-0.5f)), countHits);
+        EXPECT_EQ(hitCount, 1);
+
+        // Removing an entry with a queued update still pending must be safe
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.6f), AZ::Vector3(0.9f));
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry);
+        m_octreeScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeTests, LooseBoundsKeepEntryBoundToNodeForSmallMovements)
+    {
+        // Fatten node bounds by 50%, only scenes created from here on pick the factor up
+        m_console->PerformCommand("bg_octreeNodeBoundsFattenFactor 1.5");
+        IVisibilityScene* looseScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseBoundsTestScene"));
+
+        // Two entries in opposite octants force a split of the root node
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        looseScene->InsertOrUpdateEntry(visEntry[0]);
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[1].m_internalNode != nullptr);
+        const AzFramework::VisibilityNode* boundNode = visEntry[1].m_internalNode;
+
+        // A small movement outside the node's strict bounds but within its fattened bounds
+        // must not re-bucket the entry
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.05f), AZ::Vector3(0.25f));
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, boundNode);
+
+        // A large movement still re-buckets and queries still find the entry at its new position
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.45f), AZ::Vector3(-0.2f));
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_NE(visEntry[1].m_internalNode, boundNode);
+
+        uint32_t hitCount = 0;
+        auto countHits = [&hitCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            hitCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+        };
+        looseScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f), AZ::Vector3(-0.1f)), countHits);
+        EXPECT_GE(hitCount, 1);
+
+        looseScene->RemoveEntry(visEntry[0]);
+        looseScene->RemoveEntry(visEntry[1]);
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+        m_console->PerformCommand("bg_octreeNodeBoundsFattenFactor 1");
+    }
 }
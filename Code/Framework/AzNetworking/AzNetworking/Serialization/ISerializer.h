@@ -21,6 +21,18 @@ namespace AzNetworking
         WriteToObject
     };
 
+    //! Identifies the concrete type of a serializer instance.
+    //! Hot message serialize methods use this to dispatch once per message to the concrete wire
+    //! serializer, so per-field serialization compiles to direct rather than virtual calls.
+    //! Tooling and debug serializers report Unknown and take the generic virtual path.
+    enum class SerializerType
+    {
+        Unknown,
+        NetworkInput,
+        NetworkOutput,
+        TrackChangedNetworkOutput
+    };
+
     //! @class ISerializer
     //! @brief Interface class for all serializers to derive from.
     //!
@@ -54,6 +66,10 @@ namespace AzNetworking
         //! @return boolean true if the serializer is writing to objects that it visits
         virtual SerializerMode GetSerializerMode() const = 0;
 
+        //! Returns an enum identifying the concrete serializer type for fast dispatch on hot message paths.
+        //! @return the concrete serializer type, or Unknown for serializers without a dedicated fast path
+        virtual SerializerType GetSerializerType() const { return SerializerType::Unknown; }
+
         //! Serialize a boolean.
         //! @param value    boolean input value to serialize
         //! @param name     string name of the value being serialized
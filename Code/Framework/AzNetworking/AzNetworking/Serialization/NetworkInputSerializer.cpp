@@ -27,6 +27,11 @@ namespace AzNetworking
         return SerializerMode::ReadFromObject;
     }
 
+    SerializerType NetworkInputSerializer::GetSerializerType() const
+    {
+        return SerializerType::NetworkInput;
+    }
+
     bool NetworkInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
         uint8_t serializeValue = (value) ? 1 : 0;
@@ -30,8 +30,12 @@ namespace AzNetworking
         //! @return boolean true on success, false if there was insufficient space to store all the data
         bool CopyToBuffer(const uint8_t* data, uint32_t dataSize);
 
+        // Unhide the base class template so fields of any serializable type bind against the concrete serializer
+        using ISerializer::Serialize;
+
         // ISerializer interfaces
         SerializerMode GetSerializerMode() const override;
+        SerializerType GetSerializerType() const override;
         bool Serialize(    bool& value, const char* name) override;
         bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
         bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
@@ -26,6 +26,11 @@ namespace AzNetworking
         return SerializerMode::WriteToObject;
     }
 
+    SerializerType NetworkOutputSerializer::GetSerializerType() const
+    {
+        return SerializerType::NetworkOutput;
+    }
+
     bool NetworkOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
         uint8_t byteValue = 0;
@@ -36,8 +36,12 @@ namespace AzNetworking
         //! @return number of bytes consumed by serialization
         uint32_t GetReadSize() const;
 
+        // Unhide the base class template so fields of any serializable type bind against the concrete serializer
+        using ISerializer::Serialize;
+
         // ISerializer interfaces
         SerializerMode GetSerializerMode() const override;
+        SerializerType GetSerializerType() const override;
         bool Serialize(    bool& value, const char* name) override;
         bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
         bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
@@ -10,6 +10,7 @@
 
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 
 namespace AzNetworking
 {
@@ -26,8 +27,12 @@ namespace AzNetworking
         //! @param bufferCapacity capacity of the buffer in bytes
         TrackChangedSerializer(const uint8_t* buffer, uint32_t bufferCapacity);
 
+        // Unhide the base class template so fields of any serializable type bind against the concrete serializer
+        using ISerializer::Serialize;
+
         // ISerializer interfaces
         SerializerMode GetSerializerMode() const override;
+        SerializerType GetSerializerType() const override;
         bool Serialize(    bool& value, const char* name) override;
         bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
         bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
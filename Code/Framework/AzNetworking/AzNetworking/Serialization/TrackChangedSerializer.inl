@@ -24,6 +24,14 @@ namespace AzNetworking
         return BASE_TYPE::GetSerializerMode();
     }
 
+    template <typename BASE_TYPE>
+    SerializerType TrackChangedSerializer<BASE_TYPE>::GetSerializerType() const
+    {
+        return AZStd::is_same<BASE_TYPE, NetworkOutputSerializer>::value
+            ? SerializerType::TrackChangedNetworkOutput
+            : SerializerType::Unknown;
+    }
+
     template <typename BASE_TYPE>
     bool TrackChangedSerializer<BASE_TYPE>::Serialize(bool& value, const char* name)
     {
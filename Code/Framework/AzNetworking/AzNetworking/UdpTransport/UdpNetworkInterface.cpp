@@ -17,6 +17,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AzNetworking
 {
@@ -38,6 +39,15 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
+    AZ_CVAR(bool, net_UdpUseChecksums, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Append a fast integrity checksum to outgoing Udp packets, catches corruption that slips past the 16 bit Udp checksum");
+
+    // Trailing integrity checksum appended to outgoing packets when net_UdpUseChecksums is enabled
+    static constexpr uint32_t UdpPacketChecksumSize = sizeof(uint32_t);
+
+    static uint32_t GeneratePacketChecksum(const uint8_t* data, uint32_t size)
+    {
+        return static_cast<uint32_t>(AZ::TypeHash32(data, size));
+    }
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
@@ -210,20 +220,26 @@ namespace AzNetworking
                 continue;
             }
 
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
+            // Packets parse in place out of the reader thread's receive buffer, only encrypted
+            // sockets need to decode into scratch space first
+            const uint8_t* decodedPacketData = packet.m_buffer;
+            int32_t decodedPacketSize = packet.m_receivedBytes;
+            if (m_socket->IsEncrypted())
             {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
-            }
-            else if (decodedPacketSize < 0)
-            {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
+                m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
+                decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
+                m_decryptBuffer.Resize(AZStd::max<int32_t>(decodedPacketSize, 0));
+
+                if (decodedPacketSize == 0)
+                {
+                    // OpenSSL may have consumed packets during handshake negotiation
+                    continue;
+                }
+                else if (decodedPacketSize < 0)
+                {
+                    // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+                    continue;
+                }
             }
 
             connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
@@ -242,6 +258,24 @@ namespace AzNetworking
                 GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
             }
 
+            // Validate and strip the trailing checksum before any decompression, it covers the bytes as they came off the wire
+            if (header.IsPacketFlagSet(PacketFlag::Checksummed))
+            {
+                if (decodedPacketSize <= aznumeric_cast<int32_t>(UdpPacketChecksumSize))
+                {
+                    AZLOG_WARN("Checksummed packet is too small to hold a checksum, discarding");
+                    continue;
+                }
+                decodedPacketSize -= UdpPacketChecksumSize;
+                uint32_t receivedChecksum = 0;
+                memcpy(&receivedChecksum, decodedPacketData + decodedPacketSize, UdpPacketChecksumSize);
+                if (receivedChecksum != GeneratePacketChecksum(decodedPacketData, decodedPacketSize))
+                {
+                    AZLOG_WARN("Discarding corrupt packet that failed checksum validation");
+                    continue;
+                }
+            }
+
             if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
             {
                 // Only the payload is compressed
@@ -480,6 +514,14 @@ namespace AzNetworking
         UdpPacketHeader header(connection.GetPacketTracker(), packet.GetPacketType(), reliableSequence);
         const PacketId localPacketId = header.GetPacketId();
 
+        // The flag has to be committed before the header serializes so the receiver knows to expect the checksum trailer
+        const bool shouldChecksum = net_UdpUseChecksums;
+        if (shouldChecksum)
+        {
+            header.SetPacketFlag(PacketFlag::Checksummed, true);
+        }
+        const uint32_t checksumOverhead = shouldChecksum ? UdpPacketChecksumSize : 0;
+
         // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
         // not set up
         if (reliabilityType == ReliabilityType::Reliable)
@@ -533,12 +575,12 @@ namespace AzNetworking
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
 
-        // If the packet doesn't fit within our MTU (minus potential SSL encryption overhead), break it up
-        if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
+        // If the packet doesn't fit within our MTU (minus potential SSL encryption and checksum overhead), break it up
+        if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead - checksumOverhead)
         {
             // Each fragmented packet we send adds an extra fragmented packet header, need to deduct that from our chunk size, otherwise we infinitely loop
             // SSL encryption can also inflate our payload so we pre-emptively deduct an estimated tax
-            const uint32_t chunkSize = connection.GetConnectionMtu() - net_FragmentedHeaderOverhead - net_SslInflationOverhead;
+            const uint32_t chunkSize = connection.GetConnectionMtu() - net_FragmentedHeaderOverhead - net_SslInflationOverhead - checksumOverhead;
             const uint32_t numChunks = (packetSize + chunkSize - 1) / chunkSize; // We want to round up on the remainder
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
@@ -598,6 +640,22 @@ namespace AzNetworking
             }        
         }
 
+        // Append the checksum over the encoded bytes following the flags, after compression but before any encryption
+        if (shouldChecksum)
+        {
+            UdpPacketEncodingBuffer& checksumBuffer = (packetData == writeBuffer.GetBuffer()) ? writeBuffer : buffer;
+            const uint32_t checksum = GeneratePacketChecksum(packetData + 1, packetSize - 1);
+            const AZStd::size_t checksumOffset = checksumBuffer.GetSize();
+            if (!checksumBuffer.Resize(checksumOffset + UdpPacketChecksumSize))
+            {
+                AZLOG_ERROR("PacketId %u failed to append the integrity checksum and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
+                return InvalidPacketId;
+            }
+            memcpy(checksumBuffer.GetBuffer() + checksumOffset, &checksum, UdpPacketChecksumSize);
+            packetSize = static_cast<uint32_t>(checksumBuffer.GetSize());
+            packetData = checksumBuffer.GetBuffer();
+        }
+
         AZLOG(NET_Debug, "Sending local sequence id %d, remote sequence id %d, %s, reliable id: %d, ack vector %x",
             aznumeric_cast<int32_t>(header.GetLocalSequenceId()),
             aznumeric_cast<int32_t>(header.GetRemoteSequenceId()),
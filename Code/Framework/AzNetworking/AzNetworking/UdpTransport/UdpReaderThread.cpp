@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +185,35 @@ namespace AzNetworking
                     break;
                 }
 
+                // Drain the socket in batches, each packet occupying one MTU sized slot in the receive buffer
+                const uint32_t remainingBufferSlots = (static_cast<uint32_t>(receiveBuffer.GetCapacity()) - bufferHead) / MaxUdpTransmissionUnit;
+                const uint32_t remainingPacketSlots = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t maxPackets = AZStd::min(AZStd::min(remainingBufferSlots, remainingPacketSlots), UdpSocket::MaxReceiveBatchSize);
+                if (maxPackets == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                IpAddress addresses[UdpSocket::MaxReceiveBatchSize];
+                int32_t packetSizes[UdpSocket::MaxReceiveBatchSize];
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const int32_t receivedPacketCount = socket->ReceiveBatch(addresses, dstData, MaxUdpTransmissionUnit, maxPackets, packetSizes);
+                if (receivedPacketCount <= 0)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    break;
                 }
-                else
+
+                receiveBuffer.Resize(bufferHead + (receivedPacketCount * MaxUdpTransmissionUnit));
+                for (int32_t packetIndex = 0; packetIndex < receivedPacketCount; ++packetIndex)
+                {
+                    receivedPackets.push_back(ReceivedPacket(
+                        addresses[packetIndex], dstData + (packetIndex * MaxUdpTransmissionUnit), packetSizes[packetIndex]));
+                }
+
+                if (receivedPacketCount < static_cast<int32_t>(maxPackets))
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket was drained before the batch filled
                     break;
                 }
             }
@@ -53,6 +53,8 @@ namespace AzNetworking
         void UnregisterSocket(UdpSocket* socket);
 
         //! Returns the set of all packets consumed off the socket during the last call to ReadDataFromSocket().
+        //! Each packet's buffer pointer loans memory directly out of the reader thread's receive buffer, so
+        //! received data can be parsed in place; the pointers remain valid until the next call to SwapBuffers().
         //! @return all packets consumed off the socket during the last call to ReadDataFromSocket()
         const ReceivedPackets* GetReceivedPackets(UdpSocket* socket) const;
 
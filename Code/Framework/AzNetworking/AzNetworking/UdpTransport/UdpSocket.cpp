@@ -224,6 +224,80 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(IpAddress* outAddresses, uint8_t* outData, uint32_t packetSize, uint32_t maxPackets, int32_t* outPacketSizes) const
+    {
+        AZ_Assert(packetSize > 0, "Invalid packet size for receive");
+        AZ_Assert(outAddresses != nullptr && outData != nullptr && outPacketSizes != nullptr, "NULL output pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        const uint32_t batchSize = AZStd::min(maxPackets, MaxReceiveBatchSize);
+
+#if AZ_TRAIT_USE_SOCKET_BATCH_RECEIVE
+        mmsghdr messages[MaxReceiveBatchSize];
+        iovec iovecs[MaxReceiveBatchSize];
+        sockaddr_in fromAddresses[MaxReceiveBatchSize];
+        memset(messages, 0, sizeof(mmsghdr) * batchSize);
+        for (uint32_t i = 0; i < batchSize; ++i)
+        {
+            iovecs[i].iov_base = outData + (i * packetSize);
+            iovecs[i].iov_len = packetSize;
+            messages[i].msg_hdr.msg_iov = &iovecs[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+            messages[i].msg_hdr.msg_name = &fromAddresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(fromAddresses[i]);
+        }
+
+        const int32_t receivedPackets = recvmmsg(static_cast<int32_t>(m_socketFd), messages, batchSize, 0, nullptr);
+
+        if (receivedPackets < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+
+            bool ignoreForciblyClosedError = false;
+            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            {
+                return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+            }
+
+            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return 0;
+        }
+
+        for (int32_t i = 0; i < receivedPackets; ++i)
+        {
+            outAddresses[i] = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+            outPacketSizes[i] = static_cast<int32_t>(messages[i].msg_len);
+            m_recvPackets++;
+            m_recvBytes += outPacketSizes[i];
+        }
+        return receivedPackets;
+#else
+        // The platform has no batched datagram syscall, fall back to one receive per payload.
+        int32_t receivedPackets = 0;
+        for (uint32_t i = 0; i < batchSize; ++i)
+        {
+            const int32_t receivedBytes = Receive(outAddresses[i], outData + (i * packetSize), packetSize);
+            if (receivedBytes <= 0)
+            {
+                // Propagate a socket error if nothing was received, otherwise return what we have.
+                return (receivedBytes < 0 && receivedPackets == 0) ? receivedBytes : receivedPackets;
+            }
+            outPacketSizes[i] = receivedBytes;
+            receivedPackets++;
+        }
+        return receivedPackets;
+#endif
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
@@ -93,6 +93,19 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! The maximum number of payloads a single ReceiveBatch call can return.
+        static constexpr uint32_t MaxReceiveBatchSize = 32;
+
+        //! Receives a batch of payloads from the UDP socket, using a single syscall on platforms with batched datagram I/O.
+        //! Payload i is written to outData + (i * packetSize), its sender to outAddresses[i] and its byte count to outPacketSizes[i].
+        //! @param outAddresses   array of at least maxPackets addresses to receive the sender of each payload
+        //! @param outData        output buffer of at least maxPackets * packetSize bytes
+        //! @param packetSize     size of a single payload slot in the output buffer
+        //! @param maxPackets     maximum number of payloads to receive, clamped to MaxReceiveBatchSize
+        //! @param outPacketSizes array of at least maxPackets elements to receive the byte count of each payload
+        //! @return number of payloads received, 0 if no data was available, < 0 on error
+        int32_t ReceiveBatch(IpAddress* outAddresses, uint8_t* outData, uint32_t packetSize, uint32_t maxPackets, int32_t* outPacketSizes) const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
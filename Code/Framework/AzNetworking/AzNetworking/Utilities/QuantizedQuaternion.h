@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! @class QuantizedQuaternion
+    //! @brief quantizes a unit quaternion into 32-bits using smallest-three encoding.
+    //!
+    //! Since a unit quaternion satisfies x^2 + y^2 + z^2 + w^2 = 1, the largest magnitude component can be
+    //! reconstructed from the other three, and those three are each bounded by 1/sqrt(2) in magnitude.
+    //! The encoding stores the index of the largest component in two bits and the remaining three components
+    //! quantized to ten bits each, serializing a full rotation in four bytes rather than sixteen.
+    //! As with QuantizedValues, the locally stored value is the dequantized result of the encoding, so the
+    //! sender and all receivers observe an identical rotation.
+    class QuantizedQuaternion
+    {
+    public:
+
+        //! Default constructor, initializes to the identity rotation.
+        QuantizedQuaternion();
+
+        //! Copy construct from same type.
+        //! @param value instance to construct from
+        QuantizedQuaternion(const QuantizedQuaternion& value) = default;
+
+        //! Copy construct from a quaternion.
+        //! @param value quaternion value to construct from, assumed to be normalized
+        explicit QuantizedQuaternion(const AZ::Quaternion& value);
+
+        //! Assignment from same type.
+        //! @param rhs instance to assign from
+        QuantizedQuaternion& operator =(const QuantizedQuaternion& rhs) = default;
+
+        //! Assignment from a quaternion.
+        //! @param rhs quaternion value to assign from, assumed to be normalized
+        QuantizedQuaternion& operator =(const AZ::Quaternion& rhs);
+
+        //! Const underlying type operator.
+        //! @return the dequantized rotation
+        operator AZ::Quaternion() const;
+
+        //! Equality operator.
+        //! @param rhs value to compare against
+        //! @return boolean true if this == rhs
+        bool operator ==(const QuantizedQuaternion& rhs) const;
+
+        //! Equality operator, the comparand is quantized prior to comparison.
+        //! @param rhs value to compare against
+        //! @return boolean true if this == rhs
+        bool operator ==(const AZ::Quaternion& rhs) const;
+
+        //! Inequality operator.
+        //! @param rhs value to compare against
+        //! @return boolean true if this != rhs
+        bool operator !=(const QuantizedQuaternion& rhs) const;
+
+        //! Inequality operator, the comparand is quantized prior to comparison.
+        //! @param rhs value to compare against
+        //! @return boolean true if this != rhs
+        bool operator !=(const AZ::Quaternion& rhs) const;
+
+        //! Retrieves the quantized integral value used during serialization of this QuantizedQuaternion instance.
+        //! @return the quantized integral value used during serialization of this QuantizedQuaternion instance
+        uint32_t GetQuantizedIntegralValue() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        //! Helper method to encode and store an un-quantized rotation.
+        //! @param value the input rotation to encode and store
+        void Set(const AZ::Quaternion& value);
+
+        //! Takes the quantized integral value and stores the dequantized rotation.
+        void DecodeQuantizedValue();
+
+        AZ::Quaternion m_quantizedValue;
+        uint32_t m_serializeValue;
+    };
+}
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.inl>
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    namespace QuantizedQuaternionInternal
+    {
+        static constexpr uint32_t ComponentBits = 10;
+        static constexpr uint32_t ComponentMask = (1 << ComponentBits) - 1;
+        // The three smallest magnitude components of a unit quaternion are each bounded by 1/sqrt(2)
+        static constexpr float MaxComponentValue = 0.7071067812f;
+    }
+
+    inline QuantizedQuaternion::QuantizedQuaternion()
+    {
+        Set(AZ::Quaternion::CreateIdentity());
+    }
+
+    inline QuantizedQuaternion::QuantizedQuaternion(const AZ::Quaternion& value)
+    {
+        Set(value);
+    }
+
+    inline QuantizedQuaternion& QuantizedQuaternion::operator =(const AZ::Quaternion& rhs)
+    {
+        Set(rhs);
+        return *this;
+    }
+
+    inline QuantizedQuaternion::operator AZ::Quaternion() const
+    {
+        return m_quantizedValue;
+    }
+
+    inline bool QuantizedQuaternion::operator ==(const QuantizedQuaternion& rhs) const
+    {
+        return m_serializeValue == rhs.m_serializeValue;
+    }
+
+    inline bool QuantizedQuaternion::operator ==(const AZ::Quaternion& rhs) const
+    {
+        return m_serializeValue == QuantizedQuaternion(rhs).m_serializeValue;
+    }
+
+    inline bool QuantizedQuaternion::operator !=(const QuantizedQuaternion& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    inline bool QuantizedQuaternion::operator !=(const AZ::Quaternion& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    inline uint32_t QuantizedQuaternion::GetQuantizedIntegralValue() const
+    {
+        return m_serializeValue;
+    }
+
+    inline bool QuantizedQuaternion::Serialize(ISerializer& serializer)
+    {
+        uint32_t serializedValue = m_serializeValue;
+        serializer.Serialize(serializedValue, "Rotation");
+
+        AZ_Assert((serializer.GetSerializerMode() == SerializerMode::WriteToObject) || (m_serializeValue == serializedValue),
+            "If we're reading, the temporary serialized value must match the instance value");
+        m_serializeValue = serializedValue;
+
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            DecodeQuantizedValue();
+        }
+
+        return serializer.IsValid();
+    }
+
+    inline void QuantizedQuaternion::Set(const AZ::Quaternion& value)
+    {
+        using namespace QuantizedQuaternionInternal;
+
+        float components[4];
+        value.GetNormalized().StoreToFloat4(components);
+
+        uint32_t largestIndex = 0;
+        float largestMagnitude = 0.0f;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            const float magnitude = fabsf(components[i]);
+            if (magnitude > largestMagnitude)
+            {
+                largestMagnitude = magnitude;
+                largestIndex = i;
+            }
+        }
+
+        // q and -q represent the same rotation, flip so the reconstructed component is non-negative
+        if (components[largestIndex] < 0.0f)
+        {
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                components[i] = -components[i];
+            }
+        }
+
+        uint32_t packed = largestIndex << 30;
+        uint32_t shift = 2 * ComponentBits;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i == largestIndex)
+            {
+                continue;
+            }
+            const float clamped = AZ::GetClamp(components[i], -MaxComponentValue, MaxComponentValue);
+            const uint32_t quantized = static_cast<uint32_t>(lroundf(((clamped + MaxComponentValue) / (2.0f * MaxComponentValue)) * ComponentMask));
+            packed |= (quantized << shift);
+            shift -= ComponentBits;
+        }
+
+        m_serializeValue = packed;
+        DecodeQuantizedValue();
+    }
+
+    inline void QuantizedQuaternion::DecodeQuantizedValue()
+    {
+        using namespace QuantizedQuaternionInternal;
+
+        const uint32_t largestIndex = m_serializeValue >> 30;
+
+        float components[4];
+        float sumOfSquares = 0.0f;
+        uint32_t shift = 2 * ComponentBits;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i == largestIndex)
+            {
+                continue;
+            }
+            const uint32_t quantized = (m_serializeValue >> shift) & ComponentMask;
+            components[i] = ((static_cast<float>(quantized) / ComponentMask) * (2.0f * MaxComponentValue)) - MaxComponentValue;
+            sumOfSquares += components[i] * components[i];
+            shift -= ComponentBits;
+        }
+        components[largestIndex] = sqrtf(AZ::GetMax(1.0f - sumOfSquares, 0.0f));
+
+        m_quantizedValue = AZ::Quaternion::CreateFromFloat4(components).GetNormalized();
+    }
+}
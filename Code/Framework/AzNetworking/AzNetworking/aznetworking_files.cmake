@@ -133,6 +133,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/QuantizedQuaternion.h
+    Utilities/QuantizedQuaternion.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -256,6 +257,49 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, ReceiveBatch_ReturnsAllPendingDatagrams)
+    {
+        constexpr uint16_t ReceiverPort = 23456;
+        constexpr uint32_t PacketCount = 8;
+
+        UdpSocket receiverSocket;
+        UdpSocket senderSocket;
+        ASSERT_TRUE(receiverSocket.Open(ReceiverPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(senderSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        for (uint32_t i = 0; i < PacketCount; ++i)
+        {
+            const uint8_t payload[4] = { 0xA5, 0x5A, static_cast<uint8_t>(i), static_cast<uint8_t>(~i) };
+            EXPECT_EQ(senderSocket.Send(receiverAddress, payload, sizeof(payload), false, dtlsEndpoint, connectionQuality),
+                static_cast<int32_t>(sizeof(payload)));
+        }
+
+        IpAddress addresses[UdpSocket::MaxReceiveBatchSize];
+        int32_t packetSizes[UdpSocket::MaxReceiveBatchSize];
+        uint8_t receiveBuffer[UdpSocket::MaxReceiveBatchSize * MaxUdpTransmissionUnit];
+
+        uint32_t totalReceived = 0;
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((totalReceived < PacketCount) && (AZ::GetElapsedTimeMs() - startTimeMs < TotalIterationTimeMs))
+        {
+            const int32_t receivedPackets = receiverSocket.ReceiveBatch(
+                addresses, receiveBuffer, MaxUdpTransmissionUnit, UdpSocket::MaxReceiveBatchSize, packetSizes);
+            ASSERT_GE(receivedPackets, 0);
+            for (int32_t i = 0; i < receivedPackets; ++i)
+            {
+                EXPECT_EQ(packetSizes[i], 4);
+                EXPECT_EQ(receiveBuffer[i * MaxUdpTransmissionUnit], 0xA5);
+                totalReceived++;
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(totalReceived, PacketCount);
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
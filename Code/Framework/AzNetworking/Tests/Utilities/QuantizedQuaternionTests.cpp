@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    // A quantized rotation should reproduce the input rotation to within roughly a tenth of a degree
+    static constexpr float QuantizationToleranceRadians = 0.01f;
+
+    TEST(QuantizedQuaternion, QuantizationPreservesRotation)
+    {
+        const AZ::Quaternion testRotations[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationX(AZ::Constants::QuarterPi),
+            AZ::Quaternion::CreateRotationY(-AZ::Constants::HalfPi),
+            AZ::Quaternion::CreateRotationZ(AZ::Constants::Pi * 0.9f),
+            AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, -3.0f).GetNormalized(), 2.5f),
+            // The negated quaternion represents the same rotation and should encode identically
+            -AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, -3.0f).GetNormalized(), 2.5f)
+        };
+
+        for (const AZ::Quaternion& rotation : testRotations)
+        {
+            const AzNetworking::QuantizedQuaternion quantized(rotation);
+            const AZ::Quaternion dequantized = quantized;
+            EXPECT_TRUE(dequantized.IsUnit());
+
+            // Compare the rotations rather than the raw components, since q and -q are equivalent
+            const float dotProduct = fabsf(rotation.Dot(dequantized));
+            EXPECT_GT(dotProduct, cosf(QuantizationToleranceRadians * 0.5f));
+        }
+
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, -3.0f).GetNormalized(), 2.5f);
+        const AzNetworking::QuantizedQuaternion quantized(rotation);
+        const AzNetworking::QuantizedQuaternion quantizedNegated(-rotation);
+        EXPECT_EQ(quantized, quantizedNegated);
+    }
+
+    TEST(QuantizedQuaternion, QuantizationIsStable)
+    {
+        // Re-quantizing a dequantized rotation must produce the identical encoding,
+        // otherwise the authority would generate spurious deltas every frame
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(-2.0f, 1.0f, 4.0f).GetNormalized(), 1.25f);
+        const AzNetworking::QuantizedQuaternion quantized(rotation);
+        const AzNetworking::QuantizedQuaternion requantized(AZ::Quaternion(quantized));
+        EXPECT_EQ(quantized.GetQuantizedIntegralValue(), requantized.GetQuantizedIntegralValue());
+        EXPECT_TRUE(quantized == AZ::Quaternion(requantized));
+    }
+
+    TEST(QuantizedQuaternion, SerializeRoundTrip)
+    {
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(0.0f, 1.0f, 1.0f).GetNormalized(), -0.75f);
+        AzNetworking::QuantizedQuaternion input(rotation);
+
+        AZStd::array<uint8_t, 32> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(input.Serialize(inputSerializer));
+        EXPECT_EQ(inputSerializer.GetSize(), sizeof(uint32_t));
+
+        AzNetworking::QuantizedQuaternion output;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(output.Serialize(outputSerializer));
+
+        EXPECT_EQ(input, output);
+        EXPECT_TRUE(AZ::Quaternion(input).IsClose(AZ::Quaternion(output)));
+    }
+}
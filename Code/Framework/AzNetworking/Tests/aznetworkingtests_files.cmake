@@ -25,5 +25,6 @@ set(FILES
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/QuantizedQuaternionTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
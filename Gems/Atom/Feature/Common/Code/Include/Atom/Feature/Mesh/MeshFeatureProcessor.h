@@ -81,6 +81,7 @@ namespace AZ
             void SetMeshLodConfiguration(RPI::Cullable::LodConfiguration meshLodConfig);
             RPI::Cullable::LodConfiguration GetMeshLodConfiguration() const;
             void UpdateDrawPackets(bool forceUpdate = false);
+            bool NeedsDrawPacketUpdate();
             void BuildCullable();
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
@@ -99,10 +100,19 @@ namespace AZ
             //! A reference to the original model asset in case it got cloned before creating the model instance.
             Data::Asset<RPI::ModelAsset> m_originalModelAsset;
 
-            //! List of object SRGs used by meshes in this model 
+            //! List of object SRGs used by meshes in this model
             AZStd::vector<Data::Instance<RPI::ShaderResourceGroup>> m_objectSrgList;
+
+            //! Flat list of the unique materials referenced by the draw packets, paired with the material change id the
+            //! draw packets were last updated against. Lets Simulate() skip the per draw packet update walk for models
+            //! whose materials haven't changed, which is the common case for static geometry.
+            AZStd::vector<AZStd::pair<Data::Instance<RPI::Material>, RPI::Material::ChangeId>> m_drawPacketMaterials;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
             RPI::Scene* m_scene = nullptr;
+
+            //! Scene-level draw packet cache owned by the MeshFeatureProcessor, shared by all model instances
+            //! so identical mesh/material pairs only resolve their shaders and pipeline states once.
+            RPI::MeshDrawPacketCache* m_drawPacketCache = nullptr;
             RHI::DrawItemSortKey m_sortKey;
 
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
@@ -198,6 +208,11 @@ namespace AZ
                         
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<ModelDataInstance> m_modelData;
+
+            //! Shared cache of shader resolutions for the draw packets of this scene's model instances.
+            //! Cleared whenever the draw packets are force-rebuilt (render pipeline changes, global shader
+            //! option updates), since those events invalidate the cached pipeline states.
+            RPI::MeshDrawPacketCache m_drawPacketCache;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
@@ -60,6 +60,10 @@ namespace AZ::Render
         virtual void SetFilteringSampleCount(ShadowId id, uint16_t count) = 0;
         //! Sets all of the shadow properites in one call
         virtual void SetShadowProperties(ShadowId id, const ProjectedShadowDescriptor& descriptor) = 0;
+        //! Sets whether the shadowmap may be cached across frames. A cached shadowmap is only re-rendered after one
+        //! of the shadow's properties changes, so this should only be enabled for shadows whose casters are static.
+        //! Disabled by default.
+        virtual void SetUseCachedShadows(ShadowId id, bool useCachedShadows) = 0;
         //! Gets the current shadow properties. Useful for updating several properties at once in SetShadowProperties() without having to set every property.
         virtual const ProjectedShadowDescriptor& GetShadowProperties(ShadowId id) = 0;
     };
@@ -41,6 +41,11 @@ namespace AZ
             template <typename T>
             bool UpdateBuffer(const AZStd::vector<T>& data);
 
+            // Updates the buffer to hold all the elements of data, but only uploads the given range
+            // of elements. All elements are uploaded when the buffer has to grow.
+            template <typename T>
+            bool UpdateBufferRange(const AZStd::vector<T>& data, uint32_t firstDirtyElement, uint32_t dirtyElementCount);
+
             void UpdateSrg(RPI::ShaderResourceGroup* srg) const;
 
             bool IsValid() const;
@@ -52,6 +57,7 @@ namespace AZ
         private:
 
             bool UpdateBuffer(uint32_t elementCount, const void* data);
+            bool UpdateBufferRange(uint32_t elementCount, const void* data, uint32_t firstDirtyElement, uint32_t dirtyElementCount);
 
             Data::Instance<RPI::Buffer> m_buffer;
             RHI::ShaderInputBufferIndex m_bufferIndex;
@@ -73,5 +79,12 @@ namespace AZ
             AZ_Assert(sizeof(T) == m_elementSize, "Size of templated type doesn't match the size this GpuBuffer was initialized with.");
             return UpdateBuffer(aznumeric_cast<uint32_t>(data.size()), data.data());
         }
+
+        template <typename T>
+        bool GpuBufferHandler::UpdateBufferRange(const AZStd::vector<T>& data, uint32_t firstDirtyElement, uint32_t dirtyElementCount)
+        {
+            AZ_Assert(sizeof(T) == m_elementSize, "Size of templated type doesn't match the size this GpuBuffer was initialized with.");
+            return UpdateBufferRange(aznumeric_cast<uint32_t>(data.size()), data.data(), firstDirtyElement, dirtyElementCount);
+        }
     } // namespace Render
 } // namespace AZ
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/Utils/GpuBufferHandler.h>
+#include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AZ::Render
+{
+    // An IndexedDataVector mirrored into a GPU buffer. Tracks the contiguous range of packed
+    // elements modified since the last call to UpdateBuffer() so that only that range has to be
+    // uploaded, instead of re-uploading the whole buffer whenever any element changes. Used as
+    // shared machinery by the light feature processors, which previously each re-uploaded their
+    // full light buffer on any change.
+    template<typename DataType, typename IndexType = uint16_t>
+    class GpuIndexedDataVector
+    {
+    public:
+        static constexpr IndexType NoFreeSlot = IndexedDataVector<DataType, IndexType>::NoFreeSlot;
+
+        //! Creates the GPU buffer. Must be called before UpdateBuffer() or UpdateSrg().
+        void Init(const GpuBufferHandler::Descriptor& descriptor)
+        {
+            m_bufferHandler = GpuBufferHandler(descriptor);
+        }
+
+        //! Releases the GPU buffer and clears all data.
+        void Release()
+        {
+            m_data.Clear();
+            m_bufferHandler.Release();
+            ResetDirtyRange();
+        }
+
+        //! Creates a new entry, default-constructs it, and returns an index that references it.
+        IndexType GetFreeSlotIndex()
+        {
+            const IndexType index = m_data.GetFreeSlotIndex();
+            if (index != NoFreeSlot)
+            {
+                MarkDirty(m_data.GetRawIndex(index));
+            }
+            return index;
+        }
+
+        //! Destroys the data referenced by index and frees that index for future use.
+        void RemoveIndex(IndexType index)
+        {
+            const IndexType rawIndex = m_data.GetRawIndex(index);
+            m_data.RemoveIndex(index);
+
+            // The last element is swapped into the removed element's slot, so that slot is dirty
+            // unless the removed element was the last one.
+            if (rawIndex < m_data.GetDataCount())
+            {
+                MarkDirty(rawIndex);
+            }
+        }
+
+        //! Returns a mutable reference to the data and marks it for upload in the next UpdateBuffer().
+        DataType& GetData(IndexType index)
+        {
+            MarkDirty(m_data.GetRawIndex(index));
+            return m_data.GetData(index);
+        }
+
+        //! Read only access to the data which doesn't mark it for upload.
+        const DataType& GetConstData(IndexType index) const
+        {
+            return m_data.GetData(index);
+        }
+
+        //! Returns a count of how many items are stored.
+        size_t GetDataCount() const
+        {
+            return m_data.GetDataCount();
+        }
+
+        //! Uploads the elements modified since the last call to the GPU buffer. Does nothing when
+        //! no element was modified and the element count is unchanged.
+        bool UpdateBuffer()
+        {
+            const uint32_t elementCount = aznumeric_cast<uint32_t>(m_data.GetDataCount());
+            if (m_dirtyBegin == m_dirtyEnd && elementCount == m_bufferHandler.GetElementCount())
+            {
+                return true;
+            }
+
+            const uint32_t dirtyBegin = GetMin(m_dirtyBegin, elementCount);
+            const uint32_t dirtyEnd = GetMin(m_dirtyEnd, elementCount);
+            const bool result = m_bufferHandler.UpdateBufferRange(m_data.GetDataVector(), dirtyBegin, dirtyEnd - dirtyBegin);
+            ResetDirtyRange();
+            return result;
+        }
+
+        //! Binds the GPU buffer and its element count to the given SRG.
+        void UpdateSrg(RPI::ShaderResourceGroup* srg) const
+        {
+            m_bufferHandler.UpdateSrg(srg);
+        }
+
+        //! Returns the element count as of the last UpdateBuffer() call, matching the count bound by UpdateSrg().
+        uint32_t GetElementCount() const
+        {
+            return m_bufferHandler.GetElementCount();
+        }
+
+        const Data::Instance<RPI::Buffer> GetBuffer() const
+        {
+            return m_bufferHandler.GetBuffer();
+        }
+
+    private:
+        void MarkDirty(IndexType rawIndex)
+        {
+            const uint32_t begin = rawIndex;
+            if (m_dirtyBegin == m_dirtyEnd)
+            {
+                m_dirtyBegin = begin;
+                m_dirtyEnd = begin + 1;
+            }
+            else
+            {
+                m_dirtyBegin = GetMin(m_dirtyBegin, begin);
+                m_dirtyEnd = GetMax(m_dirtyEnd, begin + 1);
+            }
+        }
+
+        void ResetDirtyRange()
+        {
+            m_dirtyBegin = 0;
+            m_dirtyEnd = 0;
+        }
+
+        IndexedDataVector<DataType, IndexType> m_data;
+        GpuBufferHandler m_bufferHandler;
+
+        // Half open range of raw (packed) indices modified since the last UpdateBuffer() call.
+        // The range is empty when m_dirtyBegin == m_dirtyEnd.
+        uint32_t m_dirtyBegin = 0;
+        uint32_t m_dirtyEnd = 0;
+    };
+} // namespace AZ::Render
@@ -48,26 +48,24 @@ namespace AZ
             desc.m_elementSize = sizeof(CapsuleLightData);
             desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
 
-            m_lightBufferHandler = GpuBufferHandler(desc);
+            m_capsuleLightData.Init(desc);
         }
 
         void CapsuleLightFeatureProcessor::Deactivate()
         {
-            m_capsuleLightData.Clear();
-            m_lightBufferHandler.Release();
+            m_capsuleLightData.Release();
         }
 
         CapsuleLightFeatureProcessor::LightHandle CapsuleLightFeatureProcessor::AcquireLight()
         {
             uint16_t id = m_capsuleLightData.GetFreeSlotIndex();
 
-            if (id == IndexedDataVector<CapsuleLightData>::NoFreeSlot)
+            if (id == m_capsuleLightData.NoFreeSlot)
             {
                 return LightHandle(LightHandle::NullIndex);
             }
             else
             {
-                m_deviceBufferNeedsUpdate = true;
                 return LightHandle(id);
             }
         }
@@ -77,7 +75,6 @@ namespace AZ
             if (handle.IsValid())
             {
                 m_capsuleLightData.RemoveIndex(handle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
                 handle.Reset();
                 return true;
             }
@@ -91,8 +88,7 @@ namespace AZ
             LightHandle handle = AcquireLight();
             if (handle.IsValid())
             {
-                m_capsuleLightData.GetData(handle.GetIndex()) = m_capsuleLightData.GetData(sourceLightHandle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
+                m_capsuleLightData.GetData(handle.GetIndex()) = m_capsuleLightData.GetConstData(sourceLightHandle.GetIndex());
             }
             return handle;
         }
@@ -102,11 +98,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "CapsuleLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
-            if (m_deviceBufferNeedsUpdate)
-            {
-                m_lightBufferHandler.UpdateBuffer(m_capsuleLightData.GetDataVector());
-                m_deviceBufferNeedsUpdate = false;
-            }
+            m_capsuleLightData.UpdateBuffer();
         }
 
         void CapsuleLightFeatureProcessor::Render(const CapsuleLightFeatureProcessor::RenderPacket& packet)
@@ -115,7 +107,7 @@ namespace AZ
 
             for (const RPI::ViewPtr& view : packet.m_views)
             {
-                m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+                m_capsuleLightData.UpdateSrg(view->GetShaderResourceGroup().get());
             }
         }
 
@@ -129,8 +121,6 @@ namespace AZ
             rgbIntensity[0] = transformedColor.GetR();
             rgbIntensity[1] = transformedColor.GetG();
             rgbIntensity[2] = transformedColor.GetB();
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void CapsuleLightFeatureProcessor::SetCapsuleLineSegment(LightHandle handle, const Vector3& startPoint, const Vector3& endPoint)
@@ -152,8 +142,6 @@ namespace AZ
                 direction.Normalize();
                 direction.StoreToFloat3(capsuleData.m_direction.data());
             }
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void CapsuleLightFeatureProcessor::SetAttenuationRadius(LightHandle handle, float attenuationRadius)
@@ -162,7 +150,6 @@ namespace AZ
 
             attenuationRadius = AZStd::max<float>(attenuationRadius, 0.001f); // prevent divide by zero.
             m_capsuleLightData.GetData(handle.GetIndex()).m_invAttenuationRadiusSquared = 1.0f / (attenuationRadius * attenuationRadius);
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void CapsuleLightFeatureProcessor::SetCapsuleRadius(LightHandle handle, float radius)
@@ -170,7 +157,6 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to CapsuleLightFeatureProcessor::SetCapsuleRadius().");
 
             m_capsuleLightData.GetData(handle.GetIndex()).m_radius = radius;
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void CapsuleLightFeatureProcessor::SetCapsuleData(LightHandle handle, const CapsuleLightData& data)
@@ -178,17 +164,16 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to CapsuleLightFeatureProcessor::SetCapsuleData().");
 
             m_capsuleLightData.GetData(handle.GetIndex()) = data;
-            m_deviceBufferNeedsUpdate = true;
         }
 
         const Data::Instance<RPI::Buffer> CapsuleLightFeatureProcessor::GetLightBuffer()const
         {
-            return m_lightBufferHandler.GetBuffer();
+            return m_capsuleLightData.GetBuffer();
         }
 
         uint32_t CapsuleLightFeatureProcessor::GetLightCount() const
         {
-            return m_lightBufferHandler.GetElementCount();
+            return m_capsuleLightData.GetElementCount();
         }
 
     } // namespace Render
@@ -9,8 +9,7 @@
 #pragma once
 
 #include <Atom/Feature/CoreLights/CapsuleLightFeatureProcessorInterface.h>
-#include <Atom/Feature/Utils/GpuBufferHandler.h>
-#include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <Atom/Feature/Utils/GpuIndexedDataVector.h>
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
 
 namespace AZ
@@ -55,9 +54,7 @@ namespace AZ
 
             static constexpr const char* FeatureProcessorName = "CapsuleLightFeatureProcessor";
 
-            IndexedDataVector<CapsuleLightData> m_capsuleLightData;
-            GpuBufferHandler m_lightBufferHandler;
-            bool m_deviceBufferNeedsUpdate = false;
+            GpuIndexedDataVector<CapsuleLightData> m_capsuleLightData;
         };
     } // namespace Render
 } // namespace AZ
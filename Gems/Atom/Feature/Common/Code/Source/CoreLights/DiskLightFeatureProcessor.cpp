@@ -49,27 +49,25 @@ namespace AZ
             desc.m_elementSize = sizeof(DiskLightData);
             desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
 
-            m_lightBufferHandler = GpuBufferHandler(desc);
+            m_diskLightData.Init(desc);
             m_shadowFeatureProcessor = GetParentScene()->GetFeatureProcessor<ProjectedShadowFeatureProcessor>();
         }
 
         void DiskLightFeatureProcessor::Deactivate()
         {
-            m_diskLightData.Clear();
-            m_lightBufferHandler.Release();
+            m_diskLightData.Release();
         }
 
         DiskLightFeatureProcessor::LightHandle DiskLightFeatureProcessor::AcquireLight()
         {
             uint16_t id = m_diskLightData.GetFreeSlotIndex();
 
-            if (id == IndexedDataVector<DiskLightData>::NoFreeSlot)
+            if (id == m_diskLightData.NoFreeSlot)
             {
                 return LightHandle::Null;
             }
             else
            {
-                m_deviceBufferNeedsUpdate = true;
                 return LightHandle(id);
             }
         }
@@ -78,13 +76,12 @@ namespace AZ
         {
             if (handle.IsValid())
             {
-                ShadowId shadowId = ShadowId(m_diskLightData.GetData(handle.GetIndex()).m_shadowIndex);
+                ShadowId shadowId = ShadowId(m_diskLightData.GetConstData(handle.GetIndex()).m_shadowIndex);
                 if (shadowId.IsValid())
                 {
                     m_shadowFeatureProcessor->ReleaseShadow(shadowId);
                 }
                 m_diskLightData.RemoveIndex(handle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
                 handle.Reset();
                 return true;
             }
@@ -101,7 +98,7 @@ namespace AZ
                 // Get a reference to the new light
                 DiskLightData& light = m_diskLightData.GetData(handle.GetIndex());
                 // Copy data from the source light on top of it.
-                light = m_diskLightData.GetData(sourceLightHandle.GetIndex());
+                light = m_diskLightData.GetConstData(sourceLightHandle.GetIndex());
 
                 ShadowId shadowId = ShadowId(light.m_shadowIndex);
                 if (shadowId.IsValid())
@@ -112,8 +109,6 @@ namespace AZ
                     light.m_shadowIndex = cloneShadow.GetIndex();
                     m_shadowFeatureProcessor->SetShadowProperties(cloneShadow, originalDesc);
                 }
-
-                m_deviceBufferNeedsUpdate = true;
             }
             return handle;
         }
@@ -123,11 +118,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "DiskLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
-            if (m_deviceBufferNeedsUpdate)
-            {
-                m_lightBufferHandler.UpdateBuffer(m_diskLightData.GetDataVector());
-                m_deviceBufferNeedsUpdate = false;
-            }
+            m_diskLightData.UpdateBuffer();
         }
 
         void DiskLightFeatureProcessor::Render(const DiskLightFeatureProcessor::RenderPacket& packet)
@@ -136,7 +127,7 @@ namespace AZ
 
             for (const RPI::ViewPtr& view : packet.m_views)
             {
-                m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+                m_diskLightData.UpdateSrg(view->GetShaderResourceGroup().get());
             }
         }
 
@@ -150,8 +141,6 @@ namespace AZ
             rgbIntensity[0] = transformedColor.GetR();
             rgbIntensity[1] = transformedColor.GetG();
             rgbIntensity[2] = transformedColor.GetB();
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void DiskLightFeatureProcessor::SetPosition(LightHandle handle, const AZ::Vector3& lightPosition)
@@ -161,7 +150,6 @@ namespace AZ
             AZStd::array<float, 3>& position = m_diskLightData.GetData(handle.GetIndex()).m_position;
             lightPosition.StoreToFloat3(position.data());
 
-            m_deviceBufferNeedsUpdate = true;
             UpdateShadow(handle);
         }
 
@@ -172,7 +160,6 @@ namespace AZ
             AZStd::array<float, 3>& direction = m_diskLightData.GetData(handle.GetIndex()).m_direction;
             lightDirection.StoreToFloat3(direction.data());
 
-            m_deviceBufferNeedsUpdate = true;
             UpdateShadow(handle);
         }
 
@@ -183,8 +170,6 @@ namespace AZ
             attenuationRadius = AZStd::max<float>(attenuationRadius, 0.001f); // prevent divide by zero.
             DiskLightData& light = m_diskLightData.GetData(handle.GetIndex());
             light.m_invAttenuationRadiusSquared = 1.0f / (attenuationRadius * attenuationRadius);
-            
-            m_deviceBufferNeedsUpdate = true;
 
             // Update the shadow near far planes if necessary
             ShadowId shadowId = ShadowId(light.m_shadowIndex);
@@ -202,7 +187,6 @@ namespace AZ
             DiskLightData& light = m_diskLightData.GetData(handle.GetIndex());
             light.m_diskRadius = radius;
             UpdateBulbPositionOffset(light);
-            m_deviceBufferNeedsUpdate = true;
             UpdateShadow(handle);
         }
 
@@ -212,7 +196,6 @@ namespace AZ
 
             uint32_t& flags = m_diskLightData.GetData(handle.GetIndex()).m_flags;
             useCone ? flags |= DiskLightData::Flags::UseConeAngle : flags &= ~DiskLightData::Flags::UseConeAngle;
-            m_deviceBufferNeedsUpdate = true;
             UpdateShadow(handle);
         }
         
@@ -222,8 +205,6 @@ namespace AZ
             
             ValidateAndSetConeAngles(handle, innerRadians, outerRadians);
             UpdateShadow(handle);
-
-            m_deviceBufferNeedsUpdate = true;
         }
         
         void DiskLightFeatureProcessor::ValidateAndSetConeAngles(LightHandle handle, float innerRadians, float outerRadians)
@@ -251,18 +232,17 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to DiskLightFeatureProcessor::SetDiskData().");
 
             m_diskLightData.GetData(handle.GetIndex()) = data;
-            m_deviceBufferNeedsUpdate = true;
             UpdateShadow(handle);
         }
 
         const Data::Instance<RPI::Buffer> DiskLightFeatureProcessor::GetLightBuffer()const
         {
-            return m_lightBufferHandler.GetBuffer();
+            return m_diskLightData.GetBuffer();
         }
 
         uint32_t DiskLightFeatureProcessor::GetLightCount() const
         {
-            return m_lightBufferHandler.GetElementCount();
+            return m_diskLightData.GetElementCount();
         }
 
         void DiskLightFeatureProcessor::SetShadowsEnabled(LightHandle handle, bool enabled)
@@ -275,7 +255,6 @@ namespace AZ
                 m_shadowFeatureProcessor->ReleaseShadow(shadowId);
                 shadowId.Reset();
                 light.m_shadowIndex = shadowId.GetIndex();
-                m_deviceBufferNeedsUpdate = true;
             }
             else if(shadowId.IsNull() && enabled == true)
             {
@@ -287,7 +266,6 @@ namespace AZ
                 ValidateAndSetConeAngles(handle, acosf(light.m_cosInnerConeAngle), acosf(light.m_cosOuterConeAngle));
 
                 UpdateShadow(handle);
-                m_deviceBufferNeedsUpdate = true;
             }
         }
 
@@ -296,7 +274,7 @@ namespace AZ
         {
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to DiskLightFeatureProcessor::SetShadowSetting().");
             
-            DiskLightData& light = m_diskLightData.GetData(handle.GetIndex());
+            const DiskLightData& light = m_diskLightData.GetConstData(handle.GetIndex());
             ShadowId shadowId = ShadowId(light.m_shadowIndex);
 
             AZ_Assert(shadowId.IsValid(), "Attempting to set a shadow property when shadows are not enabled.");
@@ -338,7 +316,7 @@ namespace AZ
 
         void DiskLightFeatureProcessor::UpdateShadow(LightHandle handle)
         {
-            const DiskLightData& diskLight = m_diskLightData.GetData(handle.GetIndex());
+            const DiskLightData& diskLight = m_diskLightData.GetConstData(handle.GetIndex());
             ShadowId shadowId = ShadowId(diskLight.m_shadowIndex);
             if (shadowId.IsNull())
             {
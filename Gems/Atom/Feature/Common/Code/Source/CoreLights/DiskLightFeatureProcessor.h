@@ -10,8 +10,7 @@
 
 #include <Atom/Feature/CoreLights/DiskLightFeatureProcessorInterface.h>
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
-#include <Atom/Feature/Utils/GpuBufferHandler.h>
-#include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <Atom/Feature/Utils/GpuIndexedDataVector.h>
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
 namespace AZ
@@ -82,10 +81,7 @@ namespace AZ
 
             ProjectedShadowFeatureProcessor* m_shadowFeatureProcessor = nullptr;
 
-            IndexedDataVector<DiskLightData> m_diskLightData;
-            GpuBufferHandler m_lightBufferHandler;
-
-            bool m_deviceBufferNeedsUpdate = false;
+            GpuIndexedDataVector<DiskLightData> m_diskLightData;
         };
     } // namespace Render
 } // namespace AZ
@@ -56,26 +56,24 @@ namespace AZ
             desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
             m_shadowFeatureProcessor = GetParentScene()->GetFeatureProcessor<ProjectedShadowFeatureProcessor>();
 
-            m_lightBufferHandler = GpuBufferHandler(desc);
+            m_pointLightData.Init(desc);
         }
 
         void PointLightFeatureProcessor::Deactivate()
         {
-            m_pointLightData.Clear();
-            m_lightBufferHandler.Release();
+            m_pointLightData.Release();
         }
 
         PointLightFeatureProcessor::LightHandle PointLightFeatureProcessor::AcquireLight()
         {
             uint16_t id = m_pointLightData.GetFreeSlotIndex();
 
-            if (id == IndexedDataVector<PointLightData>::NoFreeSlot)
+            if (id == m_pointLightData.NoFreeSlot)
             {
                 return LightHandle::Null;
             }
             else
             {
-                m_deviceBufferNeedsUpdate = true;
                 return LightHandle(id);
             }
         }
@@ -86,7 +84,7 @@ namespace AZ
             {
                 for (int i = 0; i < PointLightData::NumShadowFaces; ++i)
                 {
-                    ShadowId shadowId = ShadowId(m_pointLightData.GetData(handle.GetIndex()).m_shadowIndices[i]);
+                    ShadowId shadowId = ShadowId(m_pointLightData.GetConstData(handle.GetIndex()).m_shadowIndices[i]);
                     if (shadowId.IsValid())
                     {
                         m_shadowFeatureProcessor->ReleaseShadow(shadowId);
@@ -94,7 +92,6 @@ namespace AZ
                 }
 
                 m_pointLightData.RemoveIndex(handle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
                 handle.Reset();
                 return true;
             }
@@ -108,8 +105,7 @@ namespace AZ
             LightHandle handle = AcquireLight();
             if (handle.IsValid())
             {
-                m_pointLightData.GetData(handle.GetIndex()) = m_pointLightData.GetData(sourceLightHandle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
+                m_pointLightData.GetData(handle.GetIndex()) = m_pointLightData.GetConstData(sourceLightHandle.GetIndex());
             }
             return handle;
         }
@@ -119,11 +115,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "PointLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
-            if (m_deviceBufferNeedsUpdate)
-            {
-                m_lightBufferHandler.UpdateBuffer(m_pointLightData.GetDataVector());
-                m_deviceBufferNeedsUpdate = false;
-            }
+            m_pointLightData.UpdateBuffer();
         }
 
         void PointLightFeatureProcessor::Render(const PointLightFeatureProcessor::RenderPacket& packet)
@@ -132,7 +124,7 @@ namespace AZ
 
             for (const RPI::ViewPtr& view : packet.m_views)
             {
-                m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+                m_pointLightData.UpdateSrg(view->GetShaderResourceGroup().get());
             }
         }
 
@@ -146,8 +138,6 @@ namespace AZ
             rgbIntensity[0] = transformedColor.GetR();
             rgbIntensity[1] = transformedColor.GetG();
             rgbIntensity[2] = transformedColor.GetB();
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void PointLightFeatureProcessor::SetPosition(LightHandle handle, const AZ::Vector3& lightPosition)
@@ -157,7 +147,6 @@ namespace AZ
             AZStd::array<float, 3>& position = m_pointLightData.GetData(handle.GetIndex()).m_position;
             lightPosition.StoreToFloat3(position.data());
 
-            m_deviceBufferNeedsUpdate = true;
             UpdateShadow(handle);
         }
 
@@ -167,7 +156,6 @@ namespace AZ
 
             attenuationRadius = AZStd::max<float>(attenuationRadius, 0.001f); // prevent divide by zero.
             m_pointLightData.GetData(handle.GetIndex()).m_invAttenuationRadiusSquared = 1.0f / (attenuationRadius * attenuationRadius);
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void PointLightFeatureProcessor::SetBulbRadius(LightHandle handle, float bulbRadius)
@@ -175,17 +163,16 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to PointLightFeatureProcessor::SetBulbRadius().");
 
             m_pointLightData.GetData(handle.GetIndex()).m_bulbRadius = bulbRadius;
-            m_deviceBufferNeedsUpdate = true;
         }
 
         const Data::Instance<RPI::Buffer> PointLightFeatureProcessor::GetLightBuffer() const
         {
-            return m_lightBufferHandler.GetBuffer();
+            return m_pointLightData.GetBuffer();
         }
 
         uint32_t PointLightFeatureProcessor::GetLightCount() const
         {
-            return m_lightBufferHandler.GetElementCount();
+            return m_pointLightData.GetElementCount();
         }
 
         void PointLightFeatureProcessor::SetShadowsEnabled(LightHandle handle, bool enabled)
@@ -200,7 +187,6 @@ namespace AZ
                     m_shadowFeatureProcessor->ReleaseShadow(shadowId);
                     shadowId.Reset();
                     light.m_shadowIndices[i] = shadowId.GetIndex();
-                    m_deviceBufferNeedsUpdate = true;
                 }
                 else if (shadowId.IsNull() && enabled)
                 {
@@ -208,7 +194,6 @@ namespace AZ
                     light.m_shadowIndices[i] = m_shadowFeatureProcessor->AcquireShadow().GetIndex();
 
                     UpdateShadow(handle);
-                    m_deviceBufferNeedsUpdate = true;
                 }
             }
         }
@@ -218,7 +203,6 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to PointLightFeatureProcessor::SetPointData().");
 
             m_pointLightData.GetData(handle.GetIndex()) = data;
-            m_deviceBufferNeedsUpdate = true;
             UpdateShadow(handle);
         }
 
@@ -226,7 +210,7 @@ namespace AZ
         {
             constexpr float SqrtHalf = 0.707106781187f; // sqrt(0.5);
 
-            const auto& pointLight = m_pointLightData.GetData(handle.GetIndex());
+            const auto& pointLight = m_pointLightData.GetConstData(handle.GetIndex());
             for (int i = 0; i < PointLightData::NumShadowFaces; ++i)
             {
                 ShadowId shadowId = ShadowId(pointLight.m_shadowIndices[i]);
@@ -262,7 +246,7 @@ namespace AZ
         {
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to PointLightFeatureProcessor::SetShadowSetting().");
 
-            auto& light = m_pointLightData.GetData(handle.GetIndex());
+            const auto& light = m_pointLightData.GetConstData(handle.GetIndex());
             for (int lightIndex = 0; lightIndex < PointLightData::NumShadowFaces; ++lightIndex)
             {
                 ShadowId shadowId = ShadowId(light.m_shadowIndices[lightIndex]);
@@ -8,6 +8,8 @@
 
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Pass/PassAttachment.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 #include <CoreLights/ProjectedShadowmapsPass.h>
@@ -152,6 +154,15 @@ namespace AZ
             return m_atlas;
         }
 
+        void ProjectedShadowmapsPass::SetChildRenderEnabled(size_t childIndex, bool enabled)
+        {
+            AZStd::array_view<RPI::Ptr<RPI::Pass>> children = GetChildren();
+            if (childIndex < children.size() && children[childIndex]->IsEnabled() != enabled)
+            {
+                children[childIndex]->SetEnabled(enabled);
+            }
+        }
+
         void ProjectedShadowmapsPass::BuildInternal()
         {
             UpdateChildren();
@@ -173,6 +184,23 @@ namespace AZ
             imageDescriptor.m_size = RHI::Size(shadowmapWidth, shadowmapWidth, 1);
             imageDescriptor.m_arraySize = m_atlas.GetArraySliceCount();
 
+            // Keep the atlas in a persistent image instead of a transient attachment, so that
+            // shadowmaps whose child passes are disabled with SetChildRenderEnabled() keep the
+            // contents they rendered last. The image is only recreated when the atlas changes size,
+            // which invalidates the cached shadowmaps anyway.
+            imageDescriptor.m_bindFlags |= RHI::ImageBindFlags::DepthStencil | RHI::ImageBindFlags::ShaderRead;
+            if (!m_atlasImage ||
+                m_atlasImage->GetDescriptor().m_size != imageDescriptor.m_size ||
+                m_atlasImage->GetDescriptor().m_arraySize != imageDescriptor.m_arraySize)
+            {
+                Data::Instance<RPI::AttachmentImagePool> pool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool();
+                const RHI::ClearValue clearValue = RHI::ClearValue::CreateDepth(1.f);
+                m_atlasImage = RPI::AttachmentImage::Create(*pool.get(), imageDescriptor, Name(attachment->m_path.GetCStr()), &clearValue, nullptr);
+            }
+            attachment->m_lifetime = RHI::AttachmentLifetimeType::Imported;
+            attachment->m_path = m_atlasImage->GetAttachmentId();
+            attachment->m_importedResource = m_atlasImage;
+
             Base::BuildInternal();
         }
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/Feature/CoreLights/CoreLightsConstants.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <AtomCore/std/containers/array_view.h>
 #include <AzCore/std/containers/vector.h>
@@ -62,6 +63,11 @@ namespace AZ
             //! This exposes the shadowmap atlas.
             ShadowmapAtlas& GetShadowmapAtlas();
 
+            //! Enables or disables rendering of the child shadowmap pass with the given index.
+            //! The atlas image persists across frames, so a disabled child keeps the shadowmap
+            //! it rendered last in the atlas.
+            void SetChildRenderEnabled(size_t childIndex, bool enabled);
+
         private:
             ProjectedShadowmapsPass() = delete;
             explicit ProjectedShadowmapsPass(const RPI::PassDescriptor& descriptor);
@@ -84,6 +90,7 @@ namespace AZ
             AZStd::vector<ShadowmapSizeWithIndices> m_sizes;
 
             ShadowmapAtlas m_atlas;
+            Data::Instance<RPI::AttachmentImage> m_atlasImage;
             bool m_updateChildren = true;
         };
     } // namespace Render
@@ -51,15 +51,14 @@ namespace AZ
             desc.m_elementSize = sizeof(QuadLightData);
             desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
 
-            m_lightBufferHandler = GpuBufferHandler(desc);
+            m_quadLightData.Init(desc);
 
             Interface<ILtcCommon>::Get()->LoadMatricesForSrg(GetParentScene()->GetShaderResourceGroup());
         }
 
         void QuadLightFeatureProcessor::Deactivate()
         {
-            m_quadLightData.Clear();
-            m_lightBufferHandler.Release();
+            m_quadLightData.Release();
         }
 
         QuadLightFeatureProcessor::LightHandle QuadLightFeatureProcessor::AcquireLight()
@@ -72,7 +71,6 @@ namespace AZ
             }
             else
             {
-                m_deviceBufferNeedsUpdate = true;
                 return LightHandle(id);
             }
         }
@@ -82,7 +80,6 @@ namespace AZ
             if (handle.IsValid())
             {
                 m_quadLightData.RemoveIndex(handle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
                 handle.Reset();
                 return true;
             }
@@ -96,8 +93,7 @@ namespace AZ
             LightHandle handle = AcquireLight();
             if (handle.IsValid())
             {
-                m_quadLightData.GetData(handle.GetIndex()) = m_quadLightData.GetData(sourceLightHandle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
+                m_quadLightData.GetData(handle.GetIndex()) = m_quadLightData.GetConstData(sourceLightHandle.GetIndex());
             }
             return handle;
         }
@@ -107,11 +103,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "QuadLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
-            if (m_deviceBufferNeedsUpdate)
-            {
-                m_lightBufferHandler.UpdateBuffer(m_quadLightData.GetDataVector());
-                m_deviceBufferNeedsUpdate = false;
-            }
+            m_quadLightData.UpdateBuffer();
         }
 
         void QuadLightFeatureProcessor::Render(const QuadLightFeatureProcessor::RenderPacket& packet)
@@ -120,7 +112,7 @@ namespace AZ
 
             for (const RPI::ViewPtr& view : packet.m_views)
             {
-                m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+                m_quadLightData.UpdateSrg(view->GetShaderResourceGroup().get());
             }
         }
 
@@ -134,8 +126,6 @@ namespace AZ
             rgbIntensity[0] = transformedColor.GetR();
             rgbIntensity[1] = transformedColor.GetG();
             rgbIntensity[2] = transformedColor.GetB();
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void QuadLightFeatureProcessor::SetPosition(LightHandle handle, const AZ::Vector3& lightPosition)
@@ -144,8 +134,6 @@ namespace AZ
 
             AZStd::array<float, 3>& position = m_quadLightData.GetData(handle.GetIndex()).m_position;
             lightPosition.StoreToFloat3(position.data());
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void QuadLightFeatureProcessor::SetOrientation(LightHandle handle, const AZ::Quaternion& orientation)
@@ -155,7 +143,6 @@ namespace AZ
             QuadLightData& data = m_quadLightData.GetData(handle.GetIndex());
             orientation.TransformVector(Vector3::CreateAxisX()).StoreToFloat3(data.m_leftDir.data());
             orientation.TransformVector(Vector3::CreateAxisY()).StoreToFloat3(data.m_upDir.data());
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void QuadLightFeatureProcessor::SetLightEmitsBothDirections(LightHandle handle, bool lightEmitsBothDirections)
@@ -163,7 +150,6 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to QuadLightFeatureProcessor::SetLightEmitsBothDirections().");
 
             m_quadLightData.GetData(handle.GetIndex()).SetFlag(QuadLightFlag::EmitBothDirections, lightEmitsBothDirections);
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void QuadLightFeatureProcessor::SetUseFastApproximation(LightHandle handle, bool useFastApproximation)
@@ -171,7 +157,6 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to QuadLightFeatureProcessor::SetLightEmitsBothDirections().");
 
             m_quadLightData.GetData(handle.GetIndex()).SetFlag(QuadLightFlag::UseFastApproximation, useFastApproximation);
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void QuadLightFeatureProcessor::SetAttenuationRadius(LightHandle handle, float attenuationRadius)
@@ -180,7 +165,6 @@ namespace AZ
 
             attenuationRadius = AZStd::max<float>(attenuationRadius, 0.001f); // prevent divide by zero.
             m_quadLightData.GetData(handle.GetIndex()).m_invAttenuationRadiusSquared = 1.0f / (attenuationRadius * attenuationRadius);
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void QuadLightFeatureProcessor::SetQuadDimensions(LightHandle handle, float width, float height)
@@ -190,7 +174,6 @@ namespace AZ
             QuadLightData& data = m_quadLightData.GetData(handle.GetIndex());
             data.m_halfWidth = width * 0.5f;
             data.m_halfHeight = height * 0.5f;
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void QuadLightFeatureProcessor::SetQuadData(LightHandle handle, const QuadLightData& data)
@@ -198,17 +181,16 @@ namespace AZ
             AZ_Assert(handle.IsValid(), "Invalid LightHandle passed to QuadLightFeatureProcessor::SetQuadData().");
 
             m_quadLightData.GetData(handle.GetIndex()) = data;
-            m_deviceBufferNeedsUpdate = true;
         }
 
         const Data::Instance<RPI::Buffer> QuadLightFeatureProcessor::GetLightBuffer()const
         {
-            return m_lightBufferHandler.GetBuffer();
+            return m_quadLightData.GetBuffer();
         }
 
         uint32_t QuadLightFeatureProcessor::GetLightCount() const
         {
-            return m_lightBufferHandler.GetElementCount();
+            return m_quadLightData.GetElementCount();
         }
 
     } // namespace Render
@@ -9,8 +9,7 @@
 #pragma once
 
 #include <Atom/Feature/CoreLights/QuadLightFeatureProcessorInterface.h>
-#include <Atom/Feature/Utils/GpuBufferHandler.h>
-#include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <Atom/Feature/Utils/GpuIndexedDataVector.h>
 
 namespace AZ
 {
@@ -57,9 +56,7 @@ namespace AZ
 
             static constexpr const char* FeatureProcessorName = "QuadLightFeatureProcessor";
 
-            IndexedDataVector<QuadLightData> m_quadLightData;
-            GpuBufferHandler m_lightBufferHandler;
-            bool m_deviceBufferNeedsUpdate = false;
+            GpuIndexedDataVector<QuadLightData> m_quadLightData;
         };
     } // namespace Render
 } // namespace AZ
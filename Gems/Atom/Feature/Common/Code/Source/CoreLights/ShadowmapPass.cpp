@@ -128,7 +128,10 @@ namespace AZ
 
             RHI::AttachmentLoadStoreAction action;
             action.m_clearValue = RHI::ClearValue::CreateDepth(1.f);
-            action.m_loadAction = m_clearEnabled ? RHI::AttachmentLoadAction::Clear : RHI::AttachmentLoadAction::DontCare;
+            // Load instead of DontCare when this pass doesn't clear: the projected shadowmap atlas
+            // persists across frames, and other regions of the slice may hold cached shadowmaps
+            // which are not re-rendered this frame.
+            action.m_loadAction = m_clearEnabled ? RHI::AttachmentLoadAction::Clear : RHI::AttachmentLoadAction::Load;
             binding.m_unifiedScopeDesc = RHI::UnifiedScopeAttachmentDescriptor(attachmentId, imageViewDescriptor, action);
 
             Base::BuildInternal();
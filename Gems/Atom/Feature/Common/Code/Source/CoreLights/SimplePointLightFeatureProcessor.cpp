@@ -48,26 +48,24 @@ namespace AZ
             desc.m_elementSize = sizeof(SimplePointLightData);
             desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
 
-            m_lightBufferHandler = GpuBufferHandler(desc);
+            m_pointLightData.Init(desc);
         }
 
         void SimplePointLightFeatureProcessor::Deactivate()
         {
-            m_pointLightData.Clear();
-            m_lightBufferHandler.Release();
+            m_pointLightData.Release();
         }
 
         SimplePointLightFeatureProcessor::LightHandle SimplePointLightFeatureProcessor::AcquireLight()
         {
             uint16_t id = m_pointLightData.GetFreeSlotIndex();
 
-            if (id == IndexedDataVector<SimplePointLightData>::NoFreeSlot)
+            if (id == m_pointLightData.NoFreeSlot)
             {
                 return LightHandle::Null;
             }
             else
             {
-                m_deviceBufferNeedsUpdate = true;
                 return LightHandle(id);
             }
         }
@@ -77,7 +75,6 @@ namespace AZ
             if (handle.IsValid())
             {
                 m_pointLightData.RemoveIndex(handle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
                 handle.Reset();
                 return true;
             }
@@ -91,8 +88,7 @@ namespace AZ
             LightHandle handle = AcquireLight();
             if (handle.IsValid())
             {
-                m_pointLightData.GetData(handle.GetIndex()) = m_pointLightData.GetData(sourceLightHandle.GetIndex());
-                m_deviceBufferNeedsUpdate = true;
+                m_pointLightData.GetData(handle.GetIndex()) = m_pointLightData.GetConstData(sourceLightHandle.GetIndex());
             }
             return handle;
         }
@@ -102,11 +98,7 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "SimplePointLightFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
-            if (m_deviceBufferNeedsUpdate)
-            {
-                m_lightBufferHandler.UpdateBuffer(m_pointLightData.GetDataVector());
-                m_deviceBufferNeedsUpdate = false;
-            }
+            m_pointLightData.UpdateBuffer();
         }
 
         void SimplePointLightFeatureProcessor::Render(const SimplePointLightFeatureProcessor::RenderPacket& packet)
@@ -115,7 +107,7 @@ namespace AZ
 
             for (const RPI::ViewPtr& view : packet.m_views)
             {
-                m_lightBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+                m_pointLightData.UpdateSrg(view->GetShaderResourceGroup().get());
             }
         }
 
@@ -129,8 +121,6 @@ namespace AZ
             rgbIntensity[0] = transformedColor.GetR();
             rgbIntensity[1] = transformedColor.GetG();
             rgbIntensity[2] = transformedColor.GetB();
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void SimplePointLightFeatureProcessor::SetPosition(LightHandle handle, const AZ::Vector3& lightPosition)
@@ -139,8 +129,6 @@ namespace AZ
 
             AZStd::array<float, 3>& position = m_pointLightData.GetData(handle.GetIndex()).m_position;
             lightPosition.StoreToFloat3(position.data());
-
-            m_deviceBufferNeedsUpdate = true;
         }
 
         void SimplePointLightFeatureProcessor::SetAttenuationRadius(LightHandle handle, float attenuationRadius)
@@ -149,17 +137,16 @@ namespace AZ
 
             attenuationRadius = AZStd::max<float>(attenuationRadius, 0.001f); // prevent divide by zero.
             m_pointLightData.GetData(handle.GetIndex()).m_invAttenuationRadiusSquared = 1.0f / (attenuationRadius * attenuationRadius);
-            m_deviceBufferNeedsUpdate = true;
         }
 
         const Data::Instance<RPI::Buffer> SimplePointLightFeatureProcessor::GetLightBuffer() const
         {
-            return m_lightBufferHandler.GetBuffer();
+            return m_pointLightData.GetBuffer();
         }
 
         uint32_t SimplePointLightFeatureProcessor::GetLightCount() const
         {
-            return m_lightBufferHandler.GetElementCount();
+            return m_pointLightData.GetElementCount();
         }
 
     } // namespace Render
@@ -10,8 +10,7 @@
 
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
 #include <Atom/Feature/CoreLights/SimplePointLightFeatureProcessorInterface.h>
-#include <Atom/Feature/Utils/GpuBufferHandler.h>
-#include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <Atom/Feature/Utils/GpuIndexedDataVector.h>
 
 namespace AZ
 {
@@ -62,9 +61,7 @@ namespace AZ
 
             static constexpr const char* FeatureProcessorName = "SimplePointLightFeatureProcessor";
 
-            IndexedDataVector<SimplePointLightData> m_pointLightData;
-            GpuBufferHandler m_lightBufferHandler;
-            bool m_deviceBufferNeedsUpdate = false;
+            GpuIndexedDataVector<SimplePointLightData> m_pointLightData;
         };
     } // namespace Render
 } // namespace AZ
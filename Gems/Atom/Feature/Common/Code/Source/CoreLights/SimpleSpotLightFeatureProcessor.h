@@ -10,8 +10,7 @@
 
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
 #include <Atom/Feature/CoreLights/SimpleSpotLightFeatureProcessorInterface.h>
-#include <Atom/Feature/Utils/GpuBufferHandler.h>
-#include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <Atom/Feature/Utils/GpuIndexedDataVector.h>
 
 namespace AZ
 {
@@ -66,9 +65,7 @@ namespace AZ
 
             static constexpr const char* FeatureProcessorName = "SimpleSpotLightFeatureProcessor";
 
-            IndexedDataVector<SimpleSpotLightData> m_pointLightData;
-            GpuBufferHandler m_lightBufferHandler;
-            bool m_deviceBufferNeedsUpdate = false;
+            GpuIndexedDataVector<SimpleSpotLightData> m_pointLightData;
         };
     } // namespace Render
 } // namespace AZ
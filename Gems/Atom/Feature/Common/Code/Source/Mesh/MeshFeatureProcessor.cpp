@@ -31,6 +31,7 @@
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
@@ -71,6 +72,7 @@ namespace AZ
             );
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
+            m_drawPacketCache.Clear();
         }
 
         void MeshFeatureProcessor::Simulate(const FeatureProcessor::SimulatePacket& packet)
@@ -80,6 +82,13 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
+            if (m_forceRebuildDrawPackets)
+            {
+                // Render pipeline changes and global shader option updates invalidate the cached
+                // shader resolutions, so drop them before the rebuild jobs repopulate the cache.
+                m_drawPacketCache.Clear();
+            }
+
             const auto iteratorRanges = m_modelData.GetParallelRanges();
             AZ::JobCompletion jobCompletion;
             for (const auto& iteratorRange : iteratorRanges)
@@ -105,11 +114,13 @@ namespace AZ
                             meshDataIter->UpdateObjectSrg();
                         }
 
-                        // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
-                        // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
-                        // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
-                        // to check every one.
-                        meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
+                        // Material properties can impact which actual shader is used, which impacts the SRG in the draw packet,
+                        // so the draw packets have to be refreshed whenever one of the model's materials changed. The flat
+                        // per-material change id check avoids walking every draw packet for the (common) unchanged models.
+                        if (m_forceRebuildDrawPackets || meshDataIter->NeedsDrawPacketUpdate())
+                        {
+                            meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
+                        }
 
                         if (meshDataIter->m_cullableNeedsRebuild)
                         {
@@ -169,6 +180,7 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_drawPacketCache = &m_drawPacketCache;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
@@ -636,6 +648,7 @@ namespace AZ
             RemoveRayTracingData();
 
             m_drawPacketListsByLod.clear();
+            m_drawPacketMaterials.clear();
             m_materialAssignments.clear();
             m_objectSrgList = {};
             m_model = {};
@@ -680,6 +693,12 @@ namespace AZ
             drawPacketListOut.clear();
             drawPacketListOut.reserve(meshCount);
 
+            // The draw packet lists are always rebuilt for all lods in order, so reset the tracked materials with the first lod.
+            if (modelLodIndex == 0)
+            {
+                m_drawPacketMaterials.clear();
+            }
+
             m_hasForwardPassIblSpecularMaterial = false;
 
             for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
@@ -754,8 +773,19 @@ namespace AZ
 
                 drawPacket.SetStencilRef(stencilRef);
                 drawPacket.SetSortKey(m_sortKey);
-                drawPacket.Update(*m_scene, false);
+                drawPacket.Update(*m_scene, false, m_drawPacketCache);
                 drawPacketListOut.emplace_back(AZStd::move(drawPacket));
+
+                // Track the unique materials of the draw packets, starting with a default change id so the packets get
+                // a first update pass in Simulate() (materials that still need a compile get picked up there).
+                const auto materialMatches = [&material](const auto& drawPacketMaterial)
+                {
+                    return drawPacketMaterial.first == material;
+                };
+                if (AZStd::find_if(m_drawPacketMaterials.begin(), m_drawPacketMaterials.end(), materialMatches) == m_drawPacketMaterials.end())
+                {
+                    m_drawPacketMaterials.emplace_back(material, RPI::Material::DEFAULT_CHANGE_ID);
+                }
             }
         }
 
@@ -1069,7 +1099,7 @@ namespace AZ
             {
                 for (auto& drawPacket : drawPacketList)
                 {
-                    if (drawPacket.Update(*m_scene, forceUpdate))
+                    if (drawPacket.Update(*m_scene, forceUpdate, m_drawPacketCache))
                     {
                         m_cullableNeedsRebuild = true;
                     }
@@ -1077,6 +1107,25 @@ namespace AZ
             }
         }
 
+        bool ModelDataInstance::NeedsDrawPacketUpdate()
+        {
+            bool needsUpdate = false;
+
+            // Check the flat material list instead of walking every draw packet across all lods. The change id of an entry
+            // is refreshed here under the same conditions that MeshDrawPacket::Update() uses for its per packet change id,
+            // so the draw packet walk that follows a detected change sees every changed packet.
+            for (auto& [material, changeId] : m_drawPacketMaterials)
+            {
+                if (!material->NeedsCompile() && changeId != material->GetCurrentChangeId())
+                {
+                    changeId = material->GetCurrentChangeId();
+                    needsUpdate = true;
+                }
+            }
+
+            return needsUpdate;
+        }
+
         void ModelDataInstance::BuildCullable()
         {
             AZ_Assert(m_cullableNeedsRebuild, "This function only needs to be called if the cullable to be rebuilt");
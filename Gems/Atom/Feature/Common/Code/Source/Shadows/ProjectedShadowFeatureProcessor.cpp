@@ -8,6 +8,7 @@
 
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
+#include <AzCore/Console/Console.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <Math/GaussianMathFilter.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -20,6 +21,15 @@
 
 namespace AZ::Render
 {
+    AZ_CVAR(uint32_t,
+        r_cachedProjectedShadowmapUpdatesPerFrame,
+        4,
+        nullptr,
+        ConsoleFunctorFlags::Null,
+        "Maximum number of cached projected shadowmaps that may start re-rendering in a single frame, 0 for no limit. "
+        "Cached shadowmaps invalidated beyond the budget are deferred round robin to the following frames."
+    );
+
     void ProjectedShadowFeatureProcessor::Reflect(ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -217,6 +227,14 @@ namespace AZ::Render
         m_filterParameterNeedsUpdate = true;
     }
     
+    void ProjectedShadowFeatureProcessor::SetUseCachedShadows(ShadowId id, bool useCachedShadows)
+    {
+        AZ_Assert(id.IsValid(), "Invalid ShadowId passed to ProjectedShadowFeatureProcessor::SetUseCachedShadows().");
+        ShadowProperty& shadowProperty = GetShadowPropertyFromShadowId(id);
+        shadowProperty.m_useCachedShadows = useCachedShadows;
+        shadowProperty.m_shadowmapRenderNeeded = true;
+    }
+
     auto ProjectedShadowFeatureProcessor::GetShadowProperties(ShadowId id) -> const ProjectedShadowDescriptor&
     {
         AZ_Assert(id.IsValid(), "Invalid ShadowId passed to ProjectedShadowFeatureProcessor::GetShadowProperties().");
@@ -275,6 +293,7 @@ namespace AZ::Render
         shadowData.m_unprojectConstants[0] = view->GetViewToClipMatrix().GetRow(2).GetElement(2);
         shadowData.m_unprojectConstants[1] = view->GetViewToClipMatrix().GetRow(2).GetElement(3);
 
+        shadowProperty.m_shadowmapRenderNeeded = true;
         m_deviceBufferNeedsUpdate = true;
     }
 
@@ -453,6 +472,13 @@ namespace AZ::Render
                 }
             }
 
+            // The atlas layout (and possibly the atlas image itself) changed, so every shadowmap
+            // has to be re-rendered at its new location.
+            for (ShadowProperty& shadowProperty : shadowProperties)
+            {
+                shadowProperty.m_shadowmapRenderNeeded = true;
+            }
+
             m_shadowmapPassNeedsUpdate = false;
         }
 
@@ -475,6 +501,41 @@ namespace AZ::Render
             if (renderPipeline)
             {
                 auto& shadowProperties = m_shadowProperties.GetDataVector();
+
+                // Decide which atlas slices to re-render this frame. The first child pass rendering
+                // into a slice clears the whole slice, so the decision is made per slice: it has to
+                // be re-rendered when any shadowmap in it does. Shadows not using cached shadowmaps
+                // re-render every frame. Cached ones only re-render after something invalidated them,
+                // and the number that may start in one frame is budgeted, selected round robin from
+                // m_cachedShadowUpdateCursor so that deferred updates are not starved.
+                const size_t shadowCount = shadowProperties.size();
+                AZStd::vector<bool> sliceNeedsRender(pass->GetShadowmapAtlas().GetArraySliceCount(), false);
+                const uint32_t updateBudget = r_cachedProjectedShadowmapUpdatesPerFrame;
+                uint32_t scheduledUpdateCount = 0;
+                for (size_t i = 0; i < shadowCount; ++i)
+                {
+                    const size_t index = (m_cachedShadowUpdateCursor + i) % shadowCount;
+                    ShadowProperty& shadowProperty = shadowProperties.at(index);
+                    const uint16_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
+                    const FilterParameter& filterData = m_shadowData.GetElement<FilterParamIndex>(shadowIndex);
+                    if (filterData.m_shadowmapSize == aznumeric_cast<uint32_t>(ShadowmapSize::None))
+                    {
+                        continue;
+                    }
+
+                    if (!shadowProperty.m_useCachedShadows)
+                    {
+                        sliceNeedsRender[pass->GetOriginInAtlas(shadowIndex).m_arraySlice] = true;
+                    }
+                    else if (shadowProperty.m_shadowmapRenderNeeded &&
+                        (updateBudget == 0 || scheduledUpdateCount < updateBudget))
+                    {
+                        sliceNeedsRender[pass->GetOriginInAtlas(shadowIndex).m_arraySlice] = true;
+                        ++scheduledUpdateCount;
+                        m_cachedShadowUpdateCursor = aznumeric_cast<uint32_t>((index + 1) % shadowCount);
+                    }
+                }
+
                 for (uint32_t i = 0; i < shadowProperties.size(); ++i)
                 {
                     ShadowProperty& shadowProperty = shadowProperties.at(i);
@@ -485,6 +546,14 @@ namespace AZ::Render
                         continue;
                     }
 
+                    const bool renderThisFrame = sliceNeedsRender[pass->GetOriginInAtlas(shadowIndex).m_arraySlice];
+                    pass->SetChildRenderEnabled(i, renderThisFrame);
+                    if (!renderThisFrame)
+                    {
+                        continue;
+                    }
+                    shadowProperty.m_shadowmapRenderNeeded = false;
+
                     const RPI::PipelineViewTag& viewTag = pass->GetPipelineViewTagOfChild(i);
                     const RHI::DrawListMask drawListMask = renderPipeline->GetDrawListMask(viewTag);
                     if (shadowProperty.m_shadowmapView->GetDrawListMask() != drawListMask)
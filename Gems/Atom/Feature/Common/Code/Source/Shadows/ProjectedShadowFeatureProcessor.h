@@ -53,6 +53,7 @@ namespace AZ::Render
         void SetFilteringSampleCount(ShadowId id, uint16_t count) override;
         void SetShadowProperties(ShadowId id, const ProjectedShadowDescriptor& descriptor) override;
         const ProjectedShadowDescriptor& GetShadowProperties(ShadowId id) override;
+        void SetUseCachedShadows(ShadowId id, bool useCachedShadows) override;
 
         void SetEsmExponent(ShadowId id, float exponent);
 
@@ -80,6 +81,10 @@ namespace AZ::Render
             RPI::ViewPtr m_shadowmapView;
             float m_bias = 0.1f;
             ShadowId m_shadowId;
+            // When true, the shadowmap is only re-rendered while m_shadowmapRenderNeeded is set.
+            bool m_useCachedShadows = false;
+            // Set whenever a change invalidates the shadowmap in the atlas, cleared when it's re-rendered.
+            bool m_shadowmapRenderNeeded = true;
         };
 
         using FilterParameter = EsmShadowmapsPass::FilterParameter;
@@ -132,6 +137,10 @@ namespace AZ::Render
         RHI::ShaderInputConstantIndex m_shadowmapAtlasSizeIndex;
         RHI::ShaderInputConstantIndex m_invShadowmapAtlasSizeIndex;
 
+        // Index in m_shadowProperties where the round robin selection of cached shadowmaps to
+        // re-render resumes next frame. See PrepareViews().
+        uint32_t m_cachedShadowUpdateCursor = 0;
+
         bool m_deviceBufferNeedsUpdate = false;
         bool m_shadowmapPassNeedsUpdate = true;
         bool m_filterParameterNeedsUpdate = false;
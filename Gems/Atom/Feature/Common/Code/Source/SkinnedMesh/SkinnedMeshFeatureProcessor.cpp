@@ -24,11 +24,13 @@
 #include <Atom/RPI.Public/RenderPipeline.h>
 
 #include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/DispatchItem.h>
 
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
@@ -36,6 +38,28 @@ namespace AZ
     {
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
+        namespace
+        {
+            // The command list skips redundant pipeline state and SRG binds, so submitting the dispatches
+            // grouped by pipeline state collapses the per-item binds to one per shader variant batch.
+            void SubmitDispatchesGroupedByPipelineState(
+                RHI::CommandList* commandList, const AZStd::unordered_set<const RHI::DispatchItem*>& dispatches)
+            {
+                AZStd::vector<const RHI::DispatchItem*> sortedDispatches(dispatches.begin(), dispatches.end());
+                AZStd::sort(
+                    sortedDispatches.begin(), sortedDispatches.end(),
+                    [](const RHI::DispatchItem* lhs, const RHI::DispatchItem* rhs)
+                    {
+                        return lhs->m_pipelineState < rhs->m_pipelineState;
+                    });
+
+                for (const RHI::DispatchItem* dispatchItem : sortedDispatches)
+                {
+                    commandList->Submit(*dispatchItem);
+                }
+            }
+        }
+
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -343,20 +367,14 @@ namespace AZ
         void SkinnedMeshFeatureProcessor::SubmitSkinningDispatchItems(RHI::CommandList* commandList)
         {
             AZStd::lock_guard lock(m_dispatchItemMutex);
-            for (const RHI::DispatchItem* dispatchItem : m_skinningDispatches)
-            {
-                commandList->Submit(*dispatchItem);
-            }
+            SubmitDispatchesGroupedByPipelineState(commandList, m_skinningDispatches);
             m_skinningDispatches.clear();
         }
 
         void SkinnedMeshFeatureProcessor::SubmitMorphTargetDispatchItems(RHI::CommandList* commandList)
         {
             AZStd::lock_guard lock(m_dispatchItemMutex);
-            for (const RHI::DispatchItem* dispatchItem : m_morphTargetDispatches)
-            {
-                commandList->Submit(*dispatchItem);
-            }
+            SubmitDispatchesGroupedByPipelineState(commandList, m_morphTargetDispatches);
             m_morphTargetDispatches.clear();
         }
 
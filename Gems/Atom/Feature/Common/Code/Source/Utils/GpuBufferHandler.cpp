@@ -62,6 +62,11 @@ namespace AZ
         }
 
         bool GpuBufferHandler::UpdateBuffer(uint32_t elementCount, const void* data)
+        {
+            return UpdateBufferRange(elementCount, data, 0, elementCount);
+        }
+
+        bool GpuBufferHandler::UpdateBufferRange(uint32_t elementCount, const void* data, uint32_t firstDirtyElement, uint32_t dirtyElementCount)
         {
             if (!IsValid())
             {
@@ -77,11 +82,20 @@ namespace AZ
             {
                 uint32_t byteCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(BufferMinSize, dataSize));
                 m_buffer->Resize(byteCount);
+
+                // Resizing discards the previous contents, so everything has to be uploaded again.
+                firstDirtyElement = 0;
+                dirtyElementCount = elementCount;
             }
 
-            if (dataSize > 0)
+            // Clamp the dirty range to the elements actually stored in the buffer.
+            firstDirtyElement = GetMin(firstDirtyElement, elementCount);
+            dirtyElementCount = GetMin(dirtyElementCount, elementCount - firstDirtyElement);
+
+            if (dirtyElementCount > 0)
             {
-                return m_buffer->UpdateData(data, dataSize, 0);
+                const uint8_t* dirtyData = reinterpret_cast<const uint8_t*>(data) + firstDirtyElement * m_elementSize;
+                return m_buffer->UpdateData(dirtyData, dirtyElementCount * m_elementSize, firstDirtyElement * m_elementSize);
             }
             return true;
         }
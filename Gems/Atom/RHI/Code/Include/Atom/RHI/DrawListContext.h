@@ -28,6 +28,14 @@ namespace AZ
          *
          * Finally, in the consume phase, the context is immutable and lists are accessible via GetList.
          */
+        //! Describes a culled draw packet and its depth from the perspective of the view.
+        //! Used to submit draw packets to a DrawListContext in bulk.
+        struct DrawPacketProperties
+        {
+            const DrawPacket* m_drawPacket = nullptr;
+            float m_depth = 0.0f;
+        };
+
         class DrawListContext final
         {
         public:
@@ -47,6 +55,12 @@ namespace AZ
             /// The depth value here is the depth of the object from the perspective of the view.
             void AddDrawPacket(const DrawPacket* drawPacket, float depth = 0.0f);
 
+            /// Filters a batch of draw packets into draw lists in a single pass. The thread local
+            /// storage is fetched once for the whole batch, so workers that accumulate their culling
+            /// results locally and submit them here avoid the per-packet storage lookup, which is
+            /// the contended path when several views are being populated concurrently.
+            void AddDrawPackets(AZStd::array_view<DrawPacketProperties> drawPackets);
+
             /// Adds an individual draw item to the draw list associated with the provided tag. This will
             /// no-op if the tag is not present in the internal draw list mask.
             void AddDrawItem(DrawListTag drawListTag, DrawItemProperties drawItemProperties);
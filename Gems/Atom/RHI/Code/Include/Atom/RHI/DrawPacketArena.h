@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Reflect/Base.h>
+#include <AzCore/Memory/IAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        //! A linear (bump) allocator for draw packets that only live for a single frame.
+        //!
+        //! Pass the arena to DrawPacketBuilder::Begin() when building per-frame dynamic packets
+        //! (UI, debug draw, impostors, etc.): each packet then costs a pointer bump into a page
+        //! instead of a general heap allocation, and DeAllocate is a no-op, so releasing tens of
+        //! thousands of transient packets at end of frame costs nothing. All memory is reclaimed
+        //! wholesale by Reset(), which the FrameScheduler calls once per frame after command list
+        //! recording has finished; standard pages are retained for re-use by the next frame.
+        //!
+        //! Packets built from the arena must not be referenced after the frame that built them.
+        //! Retained packets (e.g. mesh draw packets held across frames) should continue to use
+        //! the default allocator.
+        class DrawPacketArena final
+            : public IAllocatorAllocate
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(DrawPacketArena, AZ::SystemAllocator, 0);
+
+            //! Sized to hold several hundred typical draw packets per page.
+            static constexpr size_t DefaultPageSizeInBytes = 256 * 1024;
+
+            explicit DrawPacketArena(size_t pageSizeInBytes = DefaultPageSizeInBytes);
+            ~DrawPacketArena() override;
+
+            //! Reclaims every allocation made since the last Reset in one step.
+            //! Standard pages are rewound and kept for re-use; oversized pages that were created
+            //! for allocations larger than the page size are returned to the system allocator.
+            //! Must not be called concurrently with Allocate.
+            void Reset();
+
+            //! Returns all pages to the system allocator. Called on shutdown.
+            void ReleaseMemory();
+
+            //////////////////////////////////////////////////////////////////////////
+            // IAllocatorAllocate
+            pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+            void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+            size_type Resize(pointer_type ptr, size_type newSize) override;
+            pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+            size_type AllocationSize(pointer_type ptr) override;
+            size_type NumAllocatedBytes() const override;
+            size_type Capacity() const override;
+            IAllocatorAllocate* GetSubAllocator() override;
+            //////////////////////////////////////////////////////////////////////////
+
+        private:
+            struct Page
+            {
+                uint8_t* m_data = nullptr;
+                size_t m_capacity = 0;
+                size_t m_offset = 0;
+            };
+
+            Page CreatePage(size_t capacity) const;
+            void DestroyPage(Page& page) const;
+
+            size_t m_pageSizeInBytes = DefaultPageSizeInBytes;
+
+            mutable AZStd::mutex m_mutex;
+            AZStd::vector<Page> m_pages;
+            size_t m_activePageIndex = 0;
+            size_t m_allocatedBytes = 0;
+        };
+    }
+}
@@ -43,6 +43,9 @@ namespace AZ
 
             /// Flags controlling statistics of the pools.
             FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
+
+            /// Controls whether per-scope platform compilation is allowed to use jobs.
+            JobPolicy m_jobPolicy = JobPolicy::Serial;
         };
 
         /**
@@ -162,6 +165,8 @@ namespace AZ
 
             void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
+            void CompileScopes(FrameGraph& frameGraph, JobPolicy jobPolicy);
+
             //Returns the resource from local cache if it exists within it or create one if it doesn't and add it to the cache
             ImageView* GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor);
             BufferView* GetBufferViewFromLocalCache(Buffer* buffer, const BufferViewDescriptor& bufferViewDescriptor);
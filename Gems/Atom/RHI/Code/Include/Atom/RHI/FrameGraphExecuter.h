@@ -116,6 +116,13 @@ namespace AZ
             //! desired. By default, it is set to JobPolicy::Serial.
             void SetJobPolicy(JobPolicy jobPolicy);
 
+            //! Returns the number of command lists to partition a scope of the given cost across, where
+            //! @param commandListCostThreshold is the maximum cost a single command list should absorb.
+            //! Each command list becomes its own FrameGraphExecuteContext (and recording job), so the
+            //! count is clamped to the job worker pool width; fanning a scope out wider than the machine
+            //! only adds command list submission overhead.
+            uint32_t GetCommandListCountForScope(uint32_t totalScopeCost, uint32_t commandListCostThreshold) const;
+
             //! Adds a new group of the specified type (must inherit from FrameGraphExecuteGroup) and
             //! returns an instance. The schedule maintains ownership of the class. The user is expected
             //! to initialize the instance before returning the schedule to the external client. The returned
@@ -9,6 +9,7 @@
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
 #include <Atom/RHI.Reflect/MemoryStatistics.h>
+#include <Atom/RHI/DrawPacketArena.h>
 #include <Atom/RHI/FrameGraphBuilder.h>
 #include <Atom/RHI/FrameGraphExecuter.h>
 #include <Atom/RHI/FrameGraphCompiler.h>
@@ -185,6 +186,11 @@ namespace AZ
             //! Returns PhysicalDeviceDescriptor which can be used to extract vendor/driver information
             const PhysicalDeviceDescriptor& GetPhysicalDeviceDescriptor();
 
+            //! Returns the arena to pass to DrawPacketBuilder::Begin when building draw packets that
+            //! only live for the current frame. The arena is reset in bulk by EndFrame, so packets
+            //! built from it must not be referenced after the frame that built them.
+            DrawPacketArena& GetDrawPacketArena() { return m_drawPacketArena; }
+
         private:
             const ScopeId m_rootScopeId{"Root"};
 
@@ -219,6 +225,8 @@ namespace AZ
 
             Ptr<TransientAttachmentPool> m_transientAttachmentPool;
 
+            DrawPacketArena m_drawPacketArena;
+
             AZStd::sys_time_t m_lastFrameEndTime{};
             MemoryStatistics m_memoryStatistics;
 
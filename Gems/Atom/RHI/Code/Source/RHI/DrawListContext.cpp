@@ -67,6 +67,36 @@ namespace AZ
             }
         }
 
+        void DrawListContext::AddDrawPackets(AZStd::array_view<DrawPacketProperties> drawPackets)
+        {
+            DrawListsByTag& threadListsByTag = m_threadListsByTag.GetStorage();
+
+            for (const DrawPacketProperties& drawPacketProperties : drawPackets)
+            {
+                const DrawPacket* drawPacket = drawPacketProperties.m_drawPacket;
+                if (Validation::IsEnabled())
+                {
+                    if (!drawPacket)
+                    {
+                        AZ_Error("DrawListContext", false, "Null draw packet was added to a draw list context. This is not permitted and will crash if validation is disabled.");
+                        continue;
+                    }
+                }
+
+                for (size_t i = 0; i < drawPacket->GetDrawItemCount(); ++i)
+                {
+                    const DrawListTag drawListTag = drawPacket->GetDrawListTag(i);
+
+                    if (m_drawListMask[drawListTag.GetIndex()])
+                    {
+                        DrawItemProperties drawItem = drawPacket->GetDrawItem(i);
+                        drawItem.m_depth = drawPacketProperties.m_depth;
+                        threadListsByTag[drawListTag.GetIndex()].push_back(drawItem);
+                    }
+                }
+            }
+        }
+
         void DrawListContext::AddDrawItem(DrawListTag drawListTag, DrawItemProperties drawItemProperties)
         {
             if (Validation::IsEnabled())
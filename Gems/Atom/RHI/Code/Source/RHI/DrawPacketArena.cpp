@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <Atom/RHI/DrawPacketArena.h>
+
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        DrawPacketArena::DrawPacketArena(size_t pageSizeInBytes)
+            : m_pageSizeInBytes{pageSizeInBytes}
+        {
+            AZ_Assert(m_pageSizeInBytes > 0, "DrawPacketArena requires a non-zero page size.");
+        }
+
+        DrawPacketArena::~DrawPacketArena()
+        {
+            ReleaseMemory();
+        }
+
+        DrawPacketArena::Page DrawPacketArena::CreatePage(size_t capacity) const
+        {
+            Page page;
+            page.m_data = reinterpret_cast<uint8_t*>(
+                AllocatorInstance<SystemAllocator>::Get().Allocate(capacity, alignof(max_align_t), 0, "DrawPacketArena"));
+            page.m_capacity = capacity;
+            return page;
+        }
+
+        void DrawPacketArena::DestroyPage(Page& page) const
+        {
+            AllocatorInstance<SystemAllocator>::Get().DeAllocate(page.m_data, page.m_capacity);
+            page = Page{};
+        }
+
+        void DrawPacketArena::Reset()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            // Rewind the standard pages for re-use; oversized pages were created for a single
+            // allocation bigger than the page size, so return them rather than hold the memory.
+            auto pageIter = m_pages.begin();
+            while (pageIter != m_pages.end())
+            {
+                if (pageIter->m_capacity > m_pageSizeInBytes)
+                {
+                    DestroyPage(*pageIter);
+                    pageIter = m_pages.erase(pageIter);
+                }
+                else
+                {
+                    pageIter->m_offset = 0;
+                    ++pageIter;
+                }
+            }
+
+            m_activePageIndex = 0;
+            m_allocatedBytes = 0;
+        }
+
+        void DrawPacketArena::ReleaseMemory()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            for (Page& page : m_pages)
+            {
+                DestroyPage(page);
+            }
+            m_pages.clear();
+            m_activePageIndex = 0;
+            m_allocatedBytes = 0;
+        }
+
+        auto DrawPacketArena::Allocate(
+            size_type byteSize,
+            size_type alignment,
+            [[maybe_unused]] int flags,
+            [[maybe_unused]] const char* name,
+            [[maybe_unused]] const char* fileName,
+            [[maybe_unused]] int lineNum,
+            [[maybe_unused]] unsigned int suppressStackRecord) -> pointer_type
+        {
+            if (byteSize == 0)
+            {
+                return nullptr;
+            }
+
+            alignment = AZStd::max<size_type>(alignment, 1);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            // Allocations larger than a page get a dedicated page which Reset returns to the heap.
+            if (byteSize + alignment > m_pageSizeInBytes)
+            {
+                Page page = CreatePage(byteSize + alignment);
+                page.m_offset = page.m_capacity;
+                m_pages.push_back(page);
+                m_allocatedBytes += byteSize;
+                return reinterpret_cast<pointer_type>(SizeAlignUp(reinterpret_cast<uintptr_t>(page.m_data), alignment));
+            }
+
+            // Bump down the retained pages starting at the active one until the request fits.
+            for (; m_activePageIndex < m_pages.size(); ++m_activePageIndex)
+            {
+                Page& page = m_pages[m_activePageIndex];
+                const size_t alignedOffset = SizeAlignUp(reinterpret_cast<uintptr_t>(page.m_data) + page.m_offset, alignment) -
+                    reinterpret_cast<uintptr_t>(page.m_data);
+
+                if (alignedOffset + byteSize <= page.m_capacity)
+                {
+                    page.m_offset = alignedOffset + byteSize;
+                    m_allocatedBytes += byteSize;
+                    return page.m_data + alignedOffset;
+                }
+            }
+
+            m_pages.push_back(CreatePage(m_pageSizeInBytes));
+            m_activePageIndex = m_pages.size() - 1;
+
+            Page& page = m_pages.back();
+            const size_t alignedOffset = SizeAlignUp(reinterpret_cast<uintptr_t>(page.m_data), alignment) -
+                reinterpret_cast<uintptr_t>(page.m_data);
+            page.m_offset = alignedOffset + byteSize;
+            m_allocatedBytes += byteSize;
+            return page.m_data + alignedOffset;
+        }
+
+        void DrawPacketArena::DeAllocate(
+            [[maybe_unused]] pointer_type ptr,
+            [[maybe_unused]] size_type byteSize,
+            [[maybe_unused]] size_type alignment)
+        {
+            // Individual frees are intentionally a no-op; memory is reclaimed in bulk by Reset().
+        }
+
+        auto DrawPacketArena::Resize([[maybe_unused]] pointer_type ptr, [[maybe_unused]] size_type newSize) -> size_type
+        {
+            return 0;
+        }
+
+        auto DrawPacketArena::ReAllocate(
+            [[maybe_unused]] pointer_type ptr,
+            [[maybe_unused]] size_type newSize,
+            [[maybe_unused]] size_type newAlignment) -> pointer_type
+        {
+            return nullptr;
+        }
+
+        auto DrawPacketArena::AllocationSize([[maybe_unused]] pointer_type ptr) -> size_type
+        {
+            return 0;
+        }
+
+        auto DrawPacketArena::NumAllocatedBytes() const -> size_type
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_allocatedBytes;
+        }
+
+        auto DrawPacketArena::Capacity() const -> size_type
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            size_t capacity = 0;
+            for (const Page& page : m_pages)
+            {
+                capacity += page.m_capacity;
+            }
+            return capacity;
+        }
+
+        IAllocatorAllocate* DrawPacketArena::GetSubAllocator()
+        {
+            return nullptr;
+        }
+    }
+}
@@ -7,6 +7,7 @@
  */
 
 #include <Atom/RHI/FrameGraphCompiler.h>
+#include <Atom/RHI.Reflect/Interval.h>
 #include <Atom/RHI/BufferFrameAttachment.h>
 #include <Atom/RHI/BufferScopeAttachment.h>
 #include <Atom/RHI/Factory.h>
@@ -18,6 +19,8 @@
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
@@ -143,17 +146,61 @@ namespace AZ
             CompileResourceViews(frameGraph.GetAttachmentDatabase());
 
             /// [Phase 4] Compile platform-specific scope data after all attachments and views have been compiled.
+            CompileScopes(frameGraph, request.m_jobPolicy);
+
+            /// Perform platform-specific compilation.
+            return CompileInternal(request);
+        }
+
+        void FrameGraphCompiler::CompileScopes(FrameGraph& frameGraph, JobPolicy jobPolicy)
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Scope Compile");
+
+            const auto& scopes = frameGraph.GetScopes();
+
+            /**
+             * Each scope compiles only its own platform data (barriers, fence values, etc.) from the
+             * graph state produced by the earlier phases, which is read-only at this point. That makes
+             * the scopes independent of each other, so they can be compiled on jobs.
+             */
+            const uint32_t ScopeCompilesPerJob = 8;
+            const uint32_t scopeCount = static_cast<uint32_t>(scopes.size());
+
+            if (jobPolicy == JobPolicy::Parallel && scopeCount > ScopeCompilesPerJob)
             {
-                AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Scope Compile");
+                AZ::JobCompletion jobCompletion;
 
-                for (Scope* scope : frameGraph.GetScopes())
+                const uint32_t jobCount = DivideByMultiple(scopeCount, ScopeCompilesPerJob);
+                for (uint32_t i = 0; i < jobCount; ++i)
+                {
+                    Interval interval;
+                    interval.m_min = i * ScopeCompilesPerJob;
+                    interval.m_max = AZStd::min(interval.m_min + ScopeCompilesPerJob, scopeCount);
+
+                    const auto compileScopesForIntervalLambda = [this, &scopes, interval]()
+                    {
+                        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: compileScopesForIntervalLambda");
+
+                        for (uint32_t scopeIdx = interval.m_min; scopeIdx < interval.m_max; ++scopeIdx)
+                        {
+                            scopes[scopeIdx]->Compile(GetDevice());
+                        }
+                    };
+
+                    AZ::Job* executeIntervalJob = AZ::CreateJobFunction(AZStd::move(compileScopesForIntervalLambda), true, nullptr);
+                    executeIntervalJob->SetDependent(&jobCompletion);
+                    executeIntervalJob->Start();
+                }
+
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (Scope* scope : scopes)
                 {
                     scope->Compile(GetDevice());
                 }
             }
-
-            /// Perform platform-specific compilation.
-            return CompileInternal(request);
         }
 
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
@@ -10,6 +10,8 @@
 #include <Atom/RHI/FrameGraphExecuter.h>
 #include <Atom/RHI/FrameGraph.h>
 #include <Atom/RHI/Image.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 namespace AZ
 {
     namespace RHI
@@ -19,6 +21,16 @@ namespace AZ
             m_jobPolicy = jobPolicy;
         }
 
+        uint32_t FrameGraphExecuter::GetCommandListCountForScope(uint32_t totalScopeCost, uint32_t commandListCostThreshold) const
+        {
+            uint32_t jobThreadCount = 1;
+            if (JobContext* jobContext = JobContext::GetGlobalContext())
+            {
+                jobThreadCount = AZStd::max(jobContext->GetJobManager().GetNumWorkerThreads(), 1u);
+            }
+            return AZStd::clamp(DivideByMultiple(totalScopeCost, commandListCostThreshold), 1u, jobThreadCount);
+        }
+
         AZStd::array_view<AZStd::unique_ptr<FrameGraphExecuteGroup>> FrameGraphExecuter::GetGroups() const
         {
             return m_groups;
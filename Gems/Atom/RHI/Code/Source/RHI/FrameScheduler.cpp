@@ -107,6 +107,7 @@ namespace AZ
             m_transientAttachmentPool = nullptr;
             m_frameGraphAttachmentDatabase = nullptr;
             m_frameGraph = nullptr;
+            m_drawPacketArena.ReleaseMemory();
         }
 
         bool FrameScheduler::ValidateIsInitialized() const
@@ -200,6 +201,7 @@ namespace AZ
             frameGraphCompileRequest.m_logVerbosity = compileRequest.m_logVerbosity;
             frameGraphCompileRequest.m_compileFlags = compileRequest.m_compileFlags;
             frameGraphCompileRequest.m_statisticsFlags = compileRequest.m_statisticsFlags;
+            frameGraphCompileRequest.m_jobPolicy = compileRequest.m_jobPolicy;
 
             const MessageOutcome outcome = m_frameGraphCompiler->Compile(frameGraphCompileRequest);
             if (outcome.IsSuccess())
@@ -452,6 +454,10 @@ namespace AZ
             m_frameGraph->Clear();
             m_device->EndFrame();
 
+            // Transient draw packets were recorded into command lists during Execute, so the
+            // frame's packet memory can be reclaimed wholesale instead of freed packet by packet.
+            m_drawPacketArena.Reset();
+
             if (CheckBitsAny(m_compileRequest.m_statisticsFlags, FrameSchedulerStatisticsFlags::GatherMemoryStatistics))
             {
                 m_device->CompileMemoryStatistics(m_memoryStatistics, MemoryStatisticsReportFlags::Detail);
@@ -181,6 +181,27 @@ namespace AZ
                  *    a map of maps), or by reducing the granularity of locks (perhaps by having multiple registries).
                  */
 
+                /**
+                 * Materials animating only constant data hit this function once per instance per frame. The update
+                 * mask tells us whether any image / buffer view was set on the incoming data since the last few
+                 * compiles; if not, the view tables are identical to the stored ones and there is nothing to diff,
+                 * so we can skip the registry lock and the per-slot loops entirely.
+                 */
+                const bool diffImageViews = HasImageGroup() &&
+                    groupData.IsResourceTypeEnabledForCompilation(
+                        static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ImageViewMask) |
+                        static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ImageViewUnboundedArrayMask));
+
+                const bool diffBufferViews = HasBufferGroup() &&
+                    groupData.IsResourceTypeEnabledForCompilation(
+                        static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::BufferViewMask) |
+                        static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::BufferViewUnboundedArrayMask));
+
+                if (!diffImageViews && !diffBufferViews)
+                {
+                    return;
+                }
+
                 const auto ComputeDiffs = [this, &shaderResourceGroup](const ResourceView* resourceViewOld, const ResourceView* resourceViewNew)
                 {
                     if (resourceViewOld != resourceViewNew)
@@ -200,7 +221,7 @@ namespace AZ
                 AZStd::lock_guard<AZStd::mutex> registryLock(m_invalidateRegistryMutex);
 
                 // Generate diffs for image views.
-                if (HasImageGroup())
+                if (diffImageViews)
                 {
                     AZStd::array_view<ConstPtr<ImageView>> viewGroupOld = shaderResourceGroup.GetData().GetImageGroup();
                     AZStd::array_view<ConstPtr<ImageView>> viewGroupNew = groupData.GetImageGroup();
@@ -212,7 +233,7 @@ namespace AZ
                 }
 
                 // Generate diffs for buffer views.
-                if (HasBufferGroup())
+                if (diffBufferViews)
                 {
                     AZStd::array_view<ConstPtr<BufferView>> viewGroupOld = shaderResourceGroup.GetData().GetBufferGroup();
                     AZStd::array_view<ConstPtr<BufferView>> viewGroupNew = groupData.GetBufferGroup();
@@ -9,6 +9,7 @@
 #include "RHITestFixture.h"
 
 #include <Atom/RHI/DrawPacket.h>
+#include <Atom/RHI/DrawPacketArena.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
 #include <Atom/RHI/DrawListContext.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
@@ -105,9 +106,9 @@ namespace UnitTest
             EXPECT_EQ(drawItem->m_indexBufferView->GetHash(), m_indexBufferView.GetHash());
         }
 
-        const RHI::DrawPacket* Build(RHI::DrawPacketBuilder& builder)
+        const RHI::DrawPacket* Build(RHI::DrawPacketBuilder& builder, IAllocatorAllocate* allocator = nullptr)
         {
-            builder.Begin(nullptr);
+            builder.Begin(allocator);
 
             for (auto& srgPtr : m_srgs)
             {
@@ -326,6 +327,49 @@ namespace UnitTest
         delete drawPacket;
     }
 
+    TEST_F(DrawPacketTest, DrawPacketArenaAllocateAndReset)
+    {
+        RHI::DrawPacketArena arena(1024);
+
+        void* allocation = arena.Allocate(256, 16);
+        EXPECT_NE(allocation, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(allocation) % 16, 0);
+        EXPECT_EQ(arena.NumAllocatedBytes(), 256);
+
+        // Individual frees are a no-op; the memory stays accounted for until Reset.
+        arena.DeAllocate(allocation);
+        EXPECT_EQ(arena.NumAllocatedBytes(), 256);
+
+        // An allocation bigger than the page size gets a dedicated page.
+        void* oversized = arena.Allocate(4096, 16);
+        EXPECT_NE(oversized, nullptr);
+        EXPECT_GE(arena.Capacity(), 1024 + 4096);
+
+        arena.Reset();
+        EXPECT_EQ(arena.NumAllocatedBytes(), 0);
+
+        // Standard pages are retained across Reset, oversized pages are returned.
+        EXPECT_EQ(arena.Capacity(), 1024);
+    }
+
+    TEST_F(DrawPacketTest, DrawPacketBuildFromArena)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+
+        RHI::DrawPacketArena arena;
+
+        DrawPacketData drawPacketData(random);
+
+        RHI::DrawPacketBuilder builder;
+        const RHI::DrawPacket* drawPacket = drawPacketData.Build(builder, &arena);
+        EXPECT_GT(arena.NumAllocatedBytes(), 0);
+
+        // Deleting an arena packet releases no memory; the arena reclaims it in bulk.
+        delete drawPacket;
+        arena.Reset();
+        EXPECT_EQ(arena.NumAllocatedBytes(), 0);
+    }
+
     TEST_F(DrawPacketTest, DrawPacketBuildClearBuildNull)
     {
         AZ::SimpleLcgRandom random(s_randomSeed);
@@ -39,6 +39,7 @@ set(FILES
     Include/Atom/RHI/DrawListTagRegistry.h
     Include/Atom/RHI/DrawListContext.h
     Include/Atom/RHI/DrawPacket.h
+    Include/Atom/RHI/DrawPacketArena.h
     Include/Atom/RHI/DrawPacketBuilder.h
     Include/Atom/RHI/IndirectArguments.h
     Source/RHI/CommandList.cpp
@@ -47,6 +48,7 @@ set(FILES
     Source/RHI/DrawList.cpp
     Source/RHI/DrawListContext.cpp
     Source/RHI/DrawPacket.cpp
+    Source/RHI/DrawPacketArena.cpp
     Source/RHI/DrawPacketBuilder.cpp
     Include/Atom/RHI/Device.h
     Include/Atom/RHI/DeviceBusTraits.h
@@ -145,7 +145,7 @@ namespace AZ
                 else
                 {
                     // And then create a new group for the current scope with dedicated [1, N] command lists.
-                    const uint32_t commandListCount = AZStd::max(RHI::DivideByMultiple(totalScopeCost, CommandListCostThreshold), 1u);
+                    const uint32_t commandListCount = GetCommandListCountForScope(totalScopeCost, CommandListCostThreshold);
 
                     FrameGraphExecuteGroup* scopeContextGroup = AddGroup<FrameGraphExecuteGroup>();
                     scopeContextGroup->Init(device, scope, commandListCount, GetJobPolicy());
@@ -126,7 +126,7 @@ namespace AZ
                 else
                 {
                     // And then create a new group for the current scope with dedicated [1, N] command lists.
-                    const AZ::u32 commandListCount = AZStd::max(RHI::DivideByMultiple(totalScopeCost, CommandListCostThreshold), 1u);
+                    const AZ::u32 commandListCount = GetCommandListCountForScope(totalScopeCost, CommandListCostThreshold);
 
                     FrameGraphExecuteGroup* scopeContextGroup = AddGroup<FrameGraphExecuteGroup>();
                     scopeContextGroup->Init(device, scope, commandListCount, GetJobPolicy(), GetGroupCount());
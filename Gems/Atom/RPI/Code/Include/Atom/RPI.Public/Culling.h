@@ -217,6 +217,13 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Selects an lod (based on size-in-screnspace) and appends the appropriate DrawPackets and their view depths
+        //! to visibleDrawPackets. The culling workers use this to accumulate results locally and hand them to the view
+        //! in one AddVisibleDrawPackets() call per batch, instead of adding packets to the view one at a time.
+        uint32_t AddLodDataToView(
+            const Vector3& pos, const Cullable::LodData& lodData, const RPI::View& view,
+            AZStd::vector<RHI::DrawPacketProperties>& visibleDrawPackets);
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
@@ -16,6 +16,8 @@
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 
+#include <AzCore/std/parallel/mutex.h>
+
 
 namespace AZ
 {
@@ -26,9 +28,11 @@ namespace AZ
         //! DynamicBufferAllocator allocates DynamicBuffers within a big pre-allocated buffer by using ring buffer allocation
         //! The addresses of allocated DynamicBuffers would be available after AZ::RHI::Limits::Device::FrameCountMax frames.
         //! Since the allocations are sub-allocations they almost have zero cost with both cpu and gpu.
-        //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
-        //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
-        //!     to increase the ring buffer's size. 
+        //! Allocate is thread safe: each thread carves sub-rings out of the main ring under a mutex and then
+        //! sub-allocates from them without locking, so concurrent allocations rarely contend.
+        //! Limitation: the allocation may fail if there isn't enough unused memory available within the ring buffer.
+        //!     When that happens the ring buffer is grown to a larger size at the next FrameEnd() so subsequent
+        //!     frames don't fail again.
         class DynamicBufferAllocator
         {
             AZ_RTTI(AZ::RPI::DynamicBufferAllocator, "{82B047B3-C845-4F77-9852-747E39C53081}");
@@ -63,6 +67,28 @@ namespace AZ
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
+            // Create the ring buffer with the input size and reset the allocation state. Used by Init and when growing.
+            bool CreateRingBuffer(uint32_t ringBufferSize);
+
+            // Carve size bytes out of the ring buffer. Must be called with m_ringMutex held.
+            // Returns false if there is no contiguous range available, in which case a larger ring buffer
+            // is requested for the next frame.
+            bool AllocateFromRing(uint32_t size, uint32_t& allocatePositionOut);
+
+            // A sub-ring carved out of the main ring buffer which one thread sub-allocates from without locking.
+            // Abandoned at the end of the frame it was carved in; its memory cycles back through the main ring.
+            struct ThreadSubRing
+            {
+                DynamicBufferAllocator* m_allocator = nullptr;
+                uint64_t m_frame = 0;
+                uint32_t m_position = 0;
+                uint32_t m_end = 0;
+            };
+
+            // Size of the sub-rings carved out of the main ring for each thread. Allocations of this size
+            // or larger are allocated from the main ring directly.
+            static constexpr uint32_t SubRingSize = 64 * 1024;
+
             // The position where the buffer is available.
             uint32_t m_currentPosition = 0;
             // The upper bound limit of the allocation of current frame 
@@ -74,10 +100,21 @@ namespace AZ
             void* m_ringBufferStartAddress = 0;
             Data::Instance<Buffer> m_ringBuffer;
 
-            // Allocation history which are in use by GPU. 
+            // Allocation history which are in use by GPU.
             uint32_t m_frameStartPositions[AZ::RHI::Limits::Device::FrameCountMax];
             uint32_t m_currentFrame = 0;
 
+            // Guards the main ring state. Only taken when carving sub-rings or for large allocations.
+            AZStd::mutex m_ringMutex;
+
+            // Monotonic frame count used to invalidate the per thread sub-rings at frame boundaries.
+            // Starts at 1 so a default constructed ThreadSubRing is always stale.
+            uint64_t m_frameCount = 1;
+
+            // When the ring buffer runs out of space the requested larger size is recorded here and the
+            // ring buffer is recreated at the next FrameEnd().
+            uint32_t m_pendingRingBufferSize = 0;
+
             bool m_enableAllocationWarning = false;
         };
     }
@@ -45,7 +45,6 @@ namespace AZ
             void FrameEnd();
 
         private:
-            AZStd::mutex m_mutexBufferAlloc;
             AZStd::unique_ptr<DynamicBufferAllocator> m_bufferAlloc;
 
             AZStd::mutex m_mutexDrawContext;
@@ -147,6 +147,10 @@ namespace AZ
             // Gets the RHI Query indices from the SubQuery associated with the current frame.
             AZStd::optional<RHI::Interval> GetRhiQueryIndicesFromCurrentFrame() const;
 
+            // Gets the RHI Query indices of the SubQuery that is ready for a non-blocking readback, if any.
+            // Used by the RPI QueryPool to resolve the query's result into its result cache once per frame.
+            AZStd::optional<RHI::Interval> GetReadySubQueryIndices() const;
+
             RHI::QueryPoolScopeAttachmentType m_attachmentType = RHI::QueryPoolScopeAttachmentType::Global;
             RHI::ScopeAttachmentAccess m_attachmentAccess = RHI::ScopeAttachmentAccess::Read;
             RHI::QueryType m_queryType = RHI::QueryType::Invalid;
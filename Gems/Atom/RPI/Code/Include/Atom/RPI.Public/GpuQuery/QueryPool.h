@@ -44,7 +44,8 @@ namespace AZ
 
             virtual ~QueryPool();
 
-            //! Increments the pool FrameIndex.
+            //! Increments the pool FrameIndex, and resolves the results that became ready for readback into the
+            //! per slot result cache with a single non-blocking pass over the registered RPI Queries.
             void Update();
 
             //! Creates a new RPI Query instance, and returns the pointer.
@@ -74,6 +75,17 @@ namespace AZ
             // Readback results from the provided RHI Query indices.
             QueryResultCode GetQueryResultFromIndices(uint64_t* result, RHI::Interval rhiQueryIndices, RHI::QueryResultFlagBits queryResultFlag);
 
+            // Resolves the results of all registered RPI Queries that are ready for readback into the per slot result cache.
+            // The resolve is fire-and-forget; results that aren't available yet are skipped and the previous cached value is kept.
+            void ResolveCachedResults();
+
+            // Copies the most recently cached result of the query slot that owns the provided RHI Query indices.
+            // Returns Fail when no result has been resolved for the slot yet.
+            QueryResultCode GetCachedResult(const RHI::Interval& rhiQueryIndices, uint64_t* result);
+
+            // Returns the result cache slot index of the RPI Query that owns the provided RHI Query indices.
+            uint32_t GetQuerySlotIndex(const RHI::Interval& rhiQueryIndices) const;
+
             // Depending on the QueryType, the method to poll data from the queries vary.
             virtual RHI::ResultCode BeginQueryInternal(RHI::Interval rhiQueryIndices, RHI::CommandList& commandList);
             virtual RHI::ResultCode EndQueryInternal(RHI::Interval rhiQueryIndices, RHI::CommandList& commandList);
@@ -112,6 +124,13 @@ namespace AZ
             // RHI Query related resources.
             AZStd::vector<RHI::Ptr<RHI::Query>> m_rhiQueryArray;
             RHI::Ptr<RHI::QueryPool> m_rhiQueryPool;
+
+            // Per RPI Query slot cache of the most recently resolved results. The cache is filled once per frame in Update(),
+            // so polling the latest result of a query only copies from the cache and doesn't touch the RHI.
+            AZStd::vector<uint64_t> m_cachedResultArray;
+            AZStd::vector<bool> m_cachedResultValidArray;
+            // Scratch buffer for resolving a single result, so a failed resolve doesn't clobber the cached value.
+            AZStd::vector<uint64_t> m_resolveScratchArray;
         };
 
     }; // namespace RPI
@@ -18,6 +18,28 @@ namespace AZ
 {
     namespace RPI
     {
+        //! Streaming context used by the DefaultStreamingImageController. Adds the per-image state
+        //! needed to drive streaming from the target mips reported through StreamingImage::SetTargetMip:
+        //! the mip chain target submitted last, and when a coarser target was first seen, which is used
+        //! to apply hysteresis before trimming.
+        class DefaultStreamingImageContext final
+            : public StreamingImageContext
+        {
+            friend class DefaultStreamingImageController;
+        public:
+            AZ_CLASS_ALLOCATOR(DefaultStreamingImageContext, AZ::ThreadPoolAllocator, 0);
+
+        private:
+            static constexpr size_t InvalidTimestamp = static_cast<size_t>(-1);
+
+            // The mip chain index most recently submitted as an expand or trim target.
+            size_t m_submittedMipChainTarget = 0;
+
+            // The timestamp at which the reported target first became coarser than the submitted
+            // target; reset whenever the reported target catches up or requests more detail.
+            size_t m_trimCandidateTimestamp = InvalidTimestamp;
+        };
+
         class DefaultStreamingImageController final
             : public StreamingImageController
         {
@@ -69,6 +69,10 @@ namespace AZ
             void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Returns the index of the mip chain containing the requested mip level, with the
+            //! mip level clamped to the least detailed mip of the image.
+            size_t GetMipChainIndexForMipLevel(StreamingImage* image, uint16_t mipLevel) const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
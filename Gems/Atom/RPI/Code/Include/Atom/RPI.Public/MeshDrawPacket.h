@@ -15,6 +15,9 @@
 #include <Atom/RHI/DrawPacketBuilder.h>
 
 #include <AzCore/Math/Obb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 
 namespace AZ
@@ -23,6 +26,73 @@ namespace AZ
     {
         class Scene;
 
+        //! Caches the portion of mesh draw packet building that is identical for every instance that shares
+        //! the same mesh, material, and shader options: shader variant selection, pipeline state acquisition,
+        //! and matching the mesh streams against each shader's input contract. Per-instance state (the object
+        //! SRG with its objectId, draw SRGs, stencil ref, and sort key) still produces a unique RHI::DrawPacket
+        //! per mesh, so only the shader resolution work is deduplicated across instances.
+        //! The owner (e.g. the MeshFeatureProcessor for its scene) is responsible for clearing the cache
+        //! whenever something that is not covered by the key changes the built results, such as a render
+        //! pipeline change or a global shader option update.
+        class MeshDrawPacketCache
+        {
+        public:
+            //! The shader resolution results for one enabled shader item of the material.
+            struct ShaderData
+            {
+                Data::Instance<Shader> m_shader;
+                RHI::DrawListTag m_drawListTag;
+                const RHI::PipelineState* m_pipelineState = nullptr;
+                ModelLod::StreamBufferViewList m_streamBufferViews;
+                UvStreamTangentBitmask m_uvStreamTangentBitmask;
+                ShaderVariantKey m_shaderVariantKeyFallback;
+                bool m_needsShaderVariantKeyFallback = false;
+            };
+
+            struct Entry
+            {
+                AZStd::fixed_vector<ShaderData, RHI::DrawPacketBuilder::DrawItemCountMax> m_shaderData;
+
+                //! Pin the model lod and material so the cache key cannot alias recycled instance pointers.
+                Data::Instance<ModelLod> m_modelLod;
+                Data::Instance<Material> m_material;
+
+                //! The material change id the entry was built against, used to detect stale entries.
+                Material::ChangeId m_materialChangeId = Material::DEFAULT_CHANGE_ID;
+            };
+            using ConstEntryPtr = AZStd::shared_ptr<const Entry>;
+
+            //! Identifies one unique mesh/material pairing in the scene.
+            struct Key
+            {
+                const ModelLod* m_modelLod = nullptr;
+                size_t m_meshIndex = 0;
+                const Material* m_material = nullptr;
+                size_t m_shaderOptionsHash = 0;
+
+                bool operator==(const Key& rhs) const;
+            };
+
+            //! Returns the cached entry for the key if it exists and still matches the material's current
+            //! change id, or nullptr if the entry is missing or stale. Thread safe.
+            ConstEntryPtr Find(const Key& key, Material::ChangeId currentChangeId) const;
+
+            //! Inserts or replaces the entry for the key. Thread safe.
+            void Insert(const Key& key, ConstEntryPtr entry);
+
+            //! Removes all entries, releasing the shaders and materials they pin.
+            void Clear();
+
+        private:
+            struct KeyHasher
+            {
+                size_t operator()(const Key& key) const;
+            };
+
+            mutable AZStd::shared_mutex m_mutex;
+            AZStd::unordered_map<Key, ConstEntryPtr, KeyHasher> m_entries;
+        };
+
         //! Holds and manages an RHI DrawPacket for a specific mesh, and the resources that are needed to build and maintain it.
         class MeshDrawPacket
         {
@@ -40,7 +110,10 @@ namespace AZ
             AZ_DEFAULT_COPY(MeshDrawPacket);
             AZ_DEFAULT_MOVE(MeshDrawPacket);
 
-            bool Update(const Scene& parentScene, bool forceUpdate = false);
+            //! Rebuilds the draw packet if the material has changed (or forceUpdate is set).
+            //! When a drawPacketCache is provided, the shader resolution phase is looked up in (and
+            //! populates) the cache, so instances sharing a mesh/material pair only pay for it once.
+            bool Update(const Scene& parentScene, bool forceUpdate = false, MeshDrawPacketCache* drawPacketCache = nullptr);
 
             const RHI::DrawPacket* GetRHIDrawPacket() const;
 
@@ -51,7 +124,14 @@ namespace AZ
             Data::Instance<Material> GetMaterial();
 
         private:
-            bool DoUpdate(const Scene& parentScene);
+            bool DoUpdate(const Scene& parentScene, MeshDrawPacketCache* drawPacketCache);
+
+            //! Resolves the shaders for the material into the entry, performing variant selection,
+            //! pipeline state acquisition and stream layout matching. Returns false on failure.
+            bool BuildCacheEntry(const Scene& parentScene, MeshDrawPacketCache::Entry& entry);
+
+            //! Computes the cache key identifying this packet's mesh/material/shader-option combination.
+            MeshDrawPacketCache::Key MakeCacheKey() const;
 
             ConstPtr<RHI::DrawPacket> m_drawPacket;
 
@@ -71,6 +71,10 @@ namespace AZ
             // be automatically calculated from the size of the first output attachment and the group size dimensions.
             bool m_isFullscreenPass = false;
 
+            // Whether to request the async compute queue for this pass's scope. The frame graph compiler
+            // inserts the cross queue fences and falls back to the graphics queue when async queues are disabled.
+            bool m_useAsyncCompute = false;
+
             // ShaderReloadNotificationBus::Handler overrides...
             void OnShaderReinitialized(const Shader& shader) override;
             void OnShaderAssetReinitialized(const Data::Asset<ShaderAsset>& shaderAsset) override;
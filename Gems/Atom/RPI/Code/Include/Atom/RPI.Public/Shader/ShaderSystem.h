@@ -7,7 +7,10 @@
  */
 #pragma once
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <Atom/RHI.Reflect/Base.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
@@ -43,9 +46,24 @@ namespace AZ
             void Connect(GlobalShaderOptionUpdatedEvent::Handler& handler) override;
             void SetSupervariantName(const AZ::Name& supervariantName) override;
             const AZ::Name& GetSupervariantName() const override;
+            void RegisterShader(Shader* shader) override;
+            void UnregisterShader(Shader* shader) override;
+            void SavePipelineLibraries() override;
             ///////////////////////////////////////////////////////////////////
 
         private:
+            void SavePipelineLibrariesCommand(const AZ::ConsoleCommandContainer& arguments);
+            AZ_CONSOLEFUNC(ShaderSystem,
+                SavePipelineLibrariesCommand,
+                AZ::ConsoleFunctorFlags::Null,
+                "Writes the pipeline library of every live shader to disk, so the pipeline states "
+                "compiled so far survive a crash later in the session."
+            );
+
+            //! The set of live shader instances, used to save their pipeline libraries on demand.
+            AZStd::unordered_set<Shader*> m_shaders;
+            AZStd::mutex m_shadersMutex;
+
             AZStd::unordered_map<Name, ShaderOptionValue> m_globalShaderOptionValues;
             GlobalShaderOptionUpdatedEvent m_globalShaderOptionUpdatedEvent;
             ShaderVariantAsyncLoader m_shaderVariantAsyncLoader;
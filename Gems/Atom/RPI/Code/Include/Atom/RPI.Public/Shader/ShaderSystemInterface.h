@@ -16,6 +16,8 @@ namespace AZ
 {
     namespace RPI
     {
+        class Shader;
+
         class ShaderSystemInterface
         {
         public:
@@ -49,6 +51,17 @@ namespace AZ
             //! Currently this is used for NoMSAA supervariant support.
             virtual void SetSupervariantName(const AZ::Name& supervariantName) = 0;
             virtual const AZ::Name& GetSupervariantName() const = 0;
+
+            //! For internal use by Shader: tracks the live shader instances so the system can
+            //! save their pipeline libraries on demand.
+            virtual void RegisterShader(Shader* shader) = 0;
+            virtual void UnregisterShader(Shader* shader) = 0;
+
+            //! Writes the pipeline library (serialized driver PSO blobs) of every live shader to disk.
+            //! Each shader already saves its own library when it shuts down; call this at a convenient
+            //! point (e.g. after loading into a level) so a crash later in the session doesn't lose
+            //! the pipeline states that were compiled up to that point.
+            virtual void SavePipelineLibraries() = 0;
         };
 
     }   // namespace RPI
@@ -75,6 +75,11 @@ namespace AZ
             //! Similar to previous AddDrawPacket() but calculates depth from packet position
             void AddDrawPacket(const RHI::DrawPacket* drawPacket, Vector3 worldPosition);
 
+            //! Add a batch of draw packets to this view in a single pass. This function is thread safe.
+            //! Culling workers accumulate their visible draw packets locally and hand them over here
+            //! so the per-thread draw lists are fetched once per batch instead of once per packet.
+            void AddVisibleDrawPackets(AZStd::array_view<RHI::DrawPacketProperties> drawPackets);
+
             //! Add a draw item to this view with its associated draw list tag
             void AddDrawItem(RHI::DrawListTag drawListTag, const RHI::DrawItemProperties& drawItemProperties);
 
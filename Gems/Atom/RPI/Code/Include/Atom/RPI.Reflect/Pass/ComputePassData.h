@@ -29,12 +29,13 @@ namespace AZ
                 if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
                 {
                     serializeContext->Class<ComputePassData, RenderPassData>()
-                        ->Version(1)
+                        ->Version(2)
                         ->Field("ShaderAsset", &ComputePassData::m_shaderReference)
                         ->Field("Target Thread Count X", &ComputePassData::m_totalNumberOfThreadsX)
                         ->Field("Target Thread Count Y", &ComputePassData::m_totalNumberOfThreadsY)
                         ->Field("Target Thread Count Z", &ComputePassData::m_totalNumberOfThreadsZ)
                         ->Field("Make Fullscreen Pass", &ComputePassData::m_makeFullscreenPass)
+                        ->Field("Use Async Compute", &ComputePassData::m_useAsyncCompute)
                         ;
                 }
             }
@@ -46,6 +47,10 @@ namespace AZ
             uint32_t m_totalNumberOfThreadsZ = 0;
 
             bool m_makeFullscreenPass = false;
+
+            //! Whether to schedule the dispatch on the async compute queue so it can overlap
+            //! graphics work. Falls back to the graphics queue when async queues are disabled.
+            bool m_useAsyncCompute = false;
         };
     } // namespace RPI
 } // namespace AZ
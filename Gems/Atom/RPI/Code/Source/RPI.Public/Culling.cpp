@@ -41,7 +41,9 @@ namespace AZ
     namespace RPI
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
-        AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null,
+            "Approximate number of visibility entries each culling worker processes. Nodes are batched until this budget is "
+            "reached, so the number of workers forked per view scales with scene density.");
 
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
@@ -297,13 +299,13 @@ namespace AZ
             return worklistData;
         }
             
-        constexpr size_t WorkListCapacity = 5;
+        constexpr size_t WorkListCapacity = 64;
         using WorkListType = AZStd::fixed_vector<AzFramework::IVisibilityScene::NodeData, WorkListCapacity>;
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
         static MaskedOcclusionCulling::CullingResult TestOcclusionCulling(
-                    const AZStd::shared_ptr<WorklistData>& worklistData, 
-                    AzFramework::VisibilityEntry* visibleEntry);
+                    const AZStd::shared_ptr<WorklistData>& worklistData,
+                    const AZ::Aabb& bounds);
 #endif
 
         static void ProcessWorklist(const AZStd::shared_ptr<WorklistData>& worklistData, const WorkListType& worklist)
@@ -317,8 +319,21 @@ namespace AZ
 
             AZ_Assert(worklist.size() > 0, "Received empty worklist in ProcessWorklist");
 
+            //Visible draw packets are accumulated in this worker-local list and handed to the view in a single
+            //AddVisibleDrawPackets() call below, rather than added to the view's per-thread draw lists one at a time.
+            AZStd::vector<RHI::DrawPacketProperties> visibleDrawPackets;
+
             for (const AzFramework::IVisibilityScene::NodeData& nodeData : worklist)
             {
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+                //If the node's entire bounds are occluded then every entry inside it is too, so one rect
+                //test rejects the whole node instead of testing each entry individually.
+                if (TestOcclusionCulling(worklistData, nodeData.m_bounds) == MaskedOcclusionCulling::CullingResult::OCCLUDED)
+                {
+                    continue;
+                }
+#endif
+
                 //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
                 bool nodeIsContainedInFrustum = 
                     !worklistData->m_debugCtx->m_enableFrustumCulling || 
@@ -348,10 +363,11 @@ namespace AZ
                                 }
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+                                if (TestOcclusionCulling(worklistData, visibleEntry->m_boundingVolume) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
                                 {
-                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
+                                    numDrawPackets += AddLodDataToView(
+                                        c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, visibleDrawPackets);
                                     ++numVisibleCullables;
                                     c->m_isVisible = true;
                                 }
@@ -384,10 +400,11 @@ namespace AZ
                             else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb))
                             {
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+                                if (TestOcclusionCulling(worklistData, visibleEntry->m_boundingVolume) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
                                 {
-                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
+                                    numDrawPackets += AddLodDataToView(
+                                        c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, visibleDrawPackets);
                                     ++numVisibleCullables;
                                     c->m_isVisible = true;
                                 }
@@ -450,6 +467,12 @@ namespace AZ
 #endif
             }
 
+            if (!visibleDrawPackets.empty())
+            {
+                //Concatenate this worker's results into the view's per-thread draw lists in one pass.
+                worklistData->m_view->AddVisibleDrawPackets(visibleDrawPackets);
+            }
+
 #ifdef AZ_CULL_DEBUG_ENABLED
             if (worklistData->m_debugCtx->m_enableStats)
             {
@@ -465,8 +488,8 @@ namespace AZ
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
         static MaskedOcclusionCulling::CullingResult TestOcclusionCulling(
-            const AZStd::shared_ptr<WorklistData>& worklistData, 
-            AzFramework::VisibilityEntry* visibleEntry)
+            const AZStd::shared_ptr<WorklistData>& worklistData,
+            const AZ::Aabb& bounds)
         {
             if (!worklistData->m_maskedOcclusionCulling)
             {
@@ -477,14 +500,14 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "TestOcclusionCulling");
 #endif
 
-            if (visibleEntry->m_boundingVolume.Contains(worklistData->m_view->GetCameraTransform().GetTranslation()))
+            if (bounds.Contains(worklistData->m_view->GetCameraTransform().GetTranslation()))
             {
                 // camera is inside bounding volume
                 return MaskedOcclusionCulling::CullingResult::VISIBLE;
             }
 
-            const Vector3& minBound = visibleEntry->m_boundingVolume.GetMin();
-            const Vector3& maxBound = visibleEntry->m_boundingVolume.GetMax();
+            const Vector3& minBound = bounds.GetMin();
+            const Vector3& maxBound = bounds.GetMax();
 
             // compute bounding volume corners
             Vector4 corners[8];
@@ -621,20 +644,25 @@ namespace AZ
             ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
 
             WorkListType worklist;
+            uint32_t worklistEntryCount = 0;
+            const uint32_t workPerBatch = r_CullWorkPerBatch;
 
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling);
 
-            auto nodeVisitorLambda = [worklistData, &parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
+            auto nodeVisitorLambda = [worklistData, &parentJob, &worklist, &worklistEntryCount, workPerBatch](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
                 AZ_PROFILE_SCOPE(RPI, "nodeVisitorLambda()");
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
                 AZ_Assert(worklist.size() < worklist.capacity(), "we should always have room to push a node on the queue");
 
-                //Queue up a small list of work items (NodeData*) which will be pushed to a worker job (AddObjectsToViewJob) once the queue is full.
-                //This reduces the number of jobs in flight, reducing job-system overhead.
+                //Queue up a range of octree nodes which will be pushed to a worker job (AddObjectsToViewJob) once
+                //the batch covers roughly r_CullWorkPerBatch visibility entries. Batching by entry count rather than
+                //node count keeps the fork width proportional to scene density, so dense scenes spread across all
+                //cores while sparse scenes don't drown in job-system overhead.
+                worklistEntryCount += static_cast<uint32_t>(nodeData.m_entries.size());
                 worklist.emplace_back(AZStd::move(nodeData));
 
-                if (worklist.size() == worklist.capacity())
+                if (worklistEntryCount >= workPerBatch || worklist.size() == worklist.capacity())
                 {
                     // capture worklistData & worklist by value
                     auto processWorklist = [worklistData, worklist]()
@@ -644,6 +672,7 @@ namespace AZ
                     //Kick off a job to process the (full) worklist
                     AZ::Job* job = AZ::CreateJobFunction(processWorklist, true);
                     worklist.clear();
+                    worklistEntryCount = 0;
                     parentJob.SetContinuation(job);
                     job->Start();
                 }
@@ -683,21 +712,26 @@ namespace AZ
             ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
 
             AZStd::unique_ptr<WorkListType> worklist = AZStd::make_unique<WorkListType>();
+            uint32_t worklistEntryCount = 0;
+            const uint32_t workPerBatch = r_CullWorkPerBatch;
 
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling);
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
 
-            auto nodeVisitorLambda = [worklistData, &taskGraph, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
+            auto nodeVisitorLambda = [worklistData, &taskGraph, &worklist, &worklistEntryCount, workPerBatch](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
                 AZ_PROFILE_SCOPE(RPI, "nodeVisitorLambda()");
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
                 AZ_Assert(worklist->size() < worklist->capacity(), "we should always have room to push a node on the queue");
 
-                //Queue up a small list of work items (NodeData*) which will be pushed to a worker task once the queue is full.
-                //This reduces the number of tasks in flight, reducing task-system overhead.
+                //Queue up a range of octree nodes which will be pushed to a worker task once the batch covers
+                //roughly r_CullWorkPerBatch visibility entries. Batching by entry count rather than node count
+                //keeps the fork width proportional to scene density, so dense scenes spread across all cores
+                //while sparse scenes don't drown in task-system overhead.
+                worklistEntryCount += static_cast<uint32_t>(nodeData.m_entries.size());
                 worklist->emplace_back(AZStd::move(nodeData));
 
-                if (worklist->size() == worklist->capacity())
+                if (worklistEntryCount >= workPerBatch || worklist->size() == worklist->capacity())
                 {
                     //Task takes ownership of the worklist unique ptr
                     taskGraph.AddTask( descriptor, [worklistData, worklist = AZStd::move(worklist)]()
@@ -706,6 +740,7 @@ namespace AZ
                         // allow worklist to go out of scope and be deleted
                     });
                     worklist = AZStd::make_unique<WorkListType>();
+                    worklistEntryCount = 0;
                 }
             };
 
@@ -730,12 +765,12 @@ namespace AZ
         }
 
 
-        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
+        //Selects the lod(s) for a cullable based on its projected size in screen space and invokes
+        //addLodToDrawPacket for each selected lod. Shared by the AddLodDataToView() variants below.
+        template<typename AddLodFunctor>
+        static uint32_t SelectLods(
+            const Vector3& pos, const Cullable::LodData& lodData, const RPI::View& view, AddLodFunctor addLodToDrawPackets)
         {
-#ifdef AZ_CULL_PROFILE_DETAILED
-            AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
-#endif
-
             const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
             //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
             //which is used to determine the (vertical) projected size in screen space
@@ -754,10 +789,7 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RPI, "add draw packets: %zu", lod.m_drawPackets.size());
 #endif
                 numVisibleDrawPackets += static_cast<uint32_t>(lod.m_drawPackets.size());   //don't want to pay the cost of aznumeric_cast<> here so using static_cast<> instead
-                for (const RHI::DrawPacket* drawPacket : lod.m_drawPackets)
-                {
-                    view.AddDrawPacket(drawPacket, pos);
-                }
+                addLodToDrawPackets(lod);
             };
 
             switch (lodData.m_lodConfiguration.m_lodType)
@@ -784,6 +816,43 @@ namespace AZ
             return numVisibleDrawPackets;
         }
 
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
+#endif
+            return SelectLods(pos, lodData, view,
+                [&](const Cullable::LodData::Lod& lod)
+                {
+                    for (const RHI::DrawPacket* drawPacket : lod.m_drawPackets)
+                    {
+                        view.AddDrawPacket(drawPacket, pos);
+                    }
+                });
+        }
+
+        uint32_t AddLodDataToView(
+            const Vector3& pos, const Cullable::LodData& lodData, const RPI::View& view,
+            AZStd::vector<RHI::DrawPacketProperties>& visibleDrawPackets)
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
+#endif
+            //All draw packets for a cullable share the same position, so the view depth is computed once here
+            //and stored with each packet, matching the depth View::AddDrawPacket() derives from a world position.
+            const Vector3 cameraToObject = pos - view.GetViewToWorldMatrix().GetTranslation();
+            const float depth = cameraToObject.Dot(-view.GetViewToWorldMatrix().GetBasisZAsVector3());
+
+            return SelectLods(pos, lodData, view,
+                [&](const Cullable::LodData::Lod& lod)
+                {
+                    for (const RHI::DrawPacket* drawPacket : lod.m_drawPackets)
+                    {
+                        visibleDrawPackets.push_back({ drawPacket, depth });
+                    }
+                });
+        }
+
         void CullingScene::Activate(const Scene* parentScene)
         {
             m_parentScene = parentScene;
@@ -23,6 +23,14 @@ namespace AZ
                 return;
             }
 
+            if (!CreateRingBuffer(ringBufferSize))
+            {
+                AZ_Assert(false, "Failed to initialize DyanmicBufferAllocator");
+            }
+        }
+
+        bool DynamicBufferAllocator::CreateRingBuffer(uint32_t ringBufferSize)
+        {
             // Create the ring buffer from common pool
             RPI::CommonBufferDescriptor desc;
             desc.m_poolType = RPI::CommonBufferPoolType::DynamicInputAssembly;
@@ -33,13 +41,13 @@ namespace AZ
 
             if (m_ringBuffer.get() == nullptr)
             {
-                AZ_Assert(false, "Failed to initialize DyanmicBufferAllocator");
-                return;
+                return false;
             }
-            
+
             m_ringBufferSize = ringBufferSize;
+            m_pendingRingBufferSize = ringBufferSize;
             m_ringBufferStartAddress = m_ringBuffer->Map(m_ringBufferSize, 0);
-            
+
             m_currentPosition = 0;
             m_endPositionLimit = 0;
             m_currentFrame = 0;
@@ -47,6 +55,7 @@ namespace AZ
             {
                 m_frameStartPositions[frame] = 0;
             }
+            return true;
         }
 
         void DynamicBufferAllocator::Shutdown()
@@ -56,7 +65,7 @@ namespace AZ
             m_ringBufferStartAddress = nullptr;
         }
 
-        // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function 
+        // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function
         RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, [[maybe_unused]]uint32_t alignment)
         {
             size = RHI::AlignUp(size, alignment);
@@ -71,34 +80,90 @@ namespace AZ
             if (size > m_ringBufferSize)
             {
                 AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: try to allocate buffer which size is larger than the ring buffer size");
+                AZStd::lock_guard<AZStd::mutex> lock(m_ringMutex);
+                m_pendingRingBufferSize = AZStd::max(m_pendingRingBufferSize, RHI::NextPowerOfTwo(size));
                 return nullptr;
             }
 
+            if (size >= SubRingSize)
+            {
+                // Large allocations come out of the main ring directly.
+                AZStd::lock_guard<AZStd::mutex> lock(m_ringMutex);
+                if (!AllocateFromRing(size, allocatePosition))
+                {
+                    return nullptr;
+                }
+            }
+            else
+            {
+                static thread_local ThreadSubRing subRing;
+                if (subRing.m_allocator != this || subRing.m_frame != m_frameCount)
+                {
+                    // The sub-ring belongs to another allocator or a previous frame. Start with an empty
+                    // one so the first allocation below carves a new sub-ring out of the main ring.
+                    subRing = ThreadSubRing{ this, m_frameCount, 0, 0 };
+                }
+
+                const uint32_t alignedPosition = RHI::AlignUp(subRing.m_position, alignment);
+                if (alignedPosition + size <= subRing.m_end)
+                {
+                    allocatePosition = alignedPosition;
+                    subRing.m_position = alignedPosition + size;
+                }
+                else
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_ringMutex);
+                    uint32_t subRingPosition = 0;
+                    if (AllocateFromRing(SubRingSize, subRingPosition))
+                    {
+                        allocatePosition = subRingPosition;
+                        subRing.m_position = subRingPosition + size;
+                        subRing.m_end = subRingPosition + SubRingSize;
+                    }
+                    // The ring may be too full for a whole sub-ring but still fit the exact size.
+                    else if (!AllocateFromRing(size, allocatePosition))
+                    {
+                        return nullptr;
+                    }
+                }
+            }
+
+            RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
+            allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
+            allocatedBuffer->m_size = size;
+            allocatedBuffer->m_allocator = this;
+            return allocatedBuffer;
+        }
+
+        bool DynamicBufferAllocator::AllocateFromRing(uint32_t size, uint32_t& allocatePositionOut)
+        {
             // Return if the allocation of current frame has reached limit
             if (m_endPositionLimit == m_currentPosition && m_currentAllocatedSize > 0)
             {
                 AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
-                return nullptr;
+                m_pendingRingBufferSize = AZStd::max(m_pendingRingBufferSize, m_ringBufferSize * 2);
+                return false;
             }
 
             if (m_endPositionLimit > m_currentPosition)
             {
                 if (m_endPositionLimit - m_currentPosition >= size)
                 {
-                    allocatePosition = m_currentPosition;
+                    allocatePositionOut = m_currentPosition;
                     m_currentPosition += size;
                 }
                 else
                 {
                     AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - m_currentPosition);
-                    return nullptr;
+                    m_pendingRingBufferSize = AZStd::max(m_pendingRingBufferSize, m_ringBufferSize * 2);
+                    return false;
                 }
             }
             else
             {
                 if (m_ringBufferSize - m_currentPosition >= size)
                 {
-                    allocatePosition = m_currentPosition;
+                    allocatePositionOut = m_currentPosition;
                     m_currentPosition += size;
                     if (m_ringBufferSize == m_currentPosition)
                     {
@@ -109,24 +174,20 @@ namespace AZ
                 {
                     if (m_endPositionLimit >= size)
                     {
-                        allocatePosition = 0;
+                        allocatePositionOut = 0;
                         m_currentPosition = size;
                     }
                     else
                     {
                         AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
-                        return nullptr;
+                        m_pendingRingBufferSize = AZStd::max(m_pendingRingBufferSize, m_ringBufferSize * 2);
+                        return false;
                     }
                 }
             }
 
             m_currentAllocatedSize += size;
-
-            RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
-            allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
-            allocatedBuffer->m_size = size;
-            allocatedBuffer->m_allocator = this;
-            return allocatedBuffer;
+            return true;
         }
 
         RHI::IndexBufferView DynamicBufferAllocator::GetIndexBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, RHI::IndexFormat format)
@@ -161,6 +222,28 @@ namespace AZ
 
         void DynamicBufferAllocator::FrameEnd()
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_ringMutex);
+
+            // Invalidate the sub-rings carved out for each thread this frame.
+            m_frameCount++;
+
+            m_currentAllocatedSize = 0;
+
+            if (m_pendingRingBufferSize > m_ringBufferSize)
+            {
+                // The ring buffer ran out of space this frame. Grow it in one large slab so following frames
+                // don't fail again. All allocations are transient within a frame and the old buffer's release
+                // is deferred until the GPU is done with it, so it's safe to swap at the frame boundary.
+                m_ringBuffer->Unmap();
+                m_ringBuffer = nullptr;
+                m_ringBufferStartAddress = nullptr;
+                if (!CreateRingBuffer(m_pendingRingBufferSize))
+                {
+                    AZ_Assert(false, "DynamicBufferAllocator::FrameEnd: failed to grow the ring buffer to %d bytes", m_pendingRingBufferSize);
+                }
+                return;
+            }
+
             uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
 
             // The saved frame start position will become available since it's old than FrameCountMax. The saved start position of next frame is the new limit
@@ -170,9 +253,6 @@ namespace AZ
             m_frameStartPositions[m_currentFrame] = m_currentPosition;
 
             m_currentFrame = nextFrame;
-
-            m_currentAllocatedSize = 0;
-
         }
     }
 }
@@ -164,16 +164,23 @@ namespace AZ
                 return QueryResultCode::Fail;
             }
 
-            // Get the most recent query index that has been submitted at least (BufferedFrames-1) frames ago.
+            // The results are resolved into the RPI QueryPool's result cache once per frame (see QueryPool::Update()),
+            // so polling the latest result only copies from the cache and doesn't touch the RHI.
+            return m_queryPool->GetCachedResult(m_rhiQueryIndices, static_cast<uint64_t*>(queryResult));
+        }
+
+        AZStd::optional<RHI::Interval> Query::GetReadySubQueryIndices() const
+        {
+            // Get the most recent query index that has been submitted at least (BufferedFrames-1) frames ago, which
+            // guarantees that its result can be read back without stalling.
             const uint32_t frameOffset = BufferedFrames - 1u;
             const uint32_t latestQueryIndex = GetMostRecentSubQueryArrayIndex(frameOffset);
             if (latestQueryIndex == InvalidQueryIndex)
             {
-                return QueryResultCode::Fail;
+                return AZStd::nullopt;
             }
 
-            SubQuery& subQuery = m_subQueryArray[latestQueryIndex];
-            return m_queryPool->GetQueryResultFromIndices(static_cast<uint64_t*>(queryResult), subQuery.m_rhiQueryIndices, RHI::QueryResultFlagBits::None);
+            return m_subQueryArray[latestQueryIndex].m_rhiQueryIndices;
         }
 
         bool Query::AssignNewFrameIndexToSubQuery(uint64_t poolFrameIndex)
@@ -15,6 +15,8 @@
 #include <Atom/RPI.Public/GpuQuery/GpuQuerySystem.h>
 #include <Atom/RPI.Public/GpuQuery/QueryPool.h>
 
+#include <AzCore/std/algorithm.h>
+
 namespace AZ
 {
     namespace RPI
@@ -42,6 +44,12 @@ namespace AZ
             // Calculate the query result size.
             CalculateResultSize();
 
+            // Allocate the per slot result cache that gets filled once per frame in Update().
+            const uint32_t resultCount = m_queryResultSize / sizeof(uint64_t);
+            m_cachedResultArray.resize(m_queryCapacity * resultCount, 0u);
+            m_cachedResultValidArray.resize(m_queryCapacity, false);
+            m_resolveScratchArray.resize(resultCount, 0u);
+
             // Populate the array with available RHI Query intervals.
             CreateRhiQueryIntervals();
 
@@ -90,6 +98,9 @@ namespace AZ
         {
             // Increment the QueryPool's FrameIndex.
             m_poolFrameIndex++;
+
+            // Resolve the query results that became ready for readback into the result cache.
+            ResolveCachedResults();
         }
 
         RHI::Ptr<RPI::Query> QueryPool::CreateQuery(RHI::QueryPoolScopeAttachmentType attachmentType, RHI::ScopeAttachmentAccess attachmentAccess)
@@ -108,6 +119,9 @@ namespace AZ
             RHI::Interval rhiQueryIndices = m_availableIntervalArray.back();
             m_availableIntervalArray.pop_back();
 
+            // Invalidate the cached result of the slot, it may still hold the result of a previously unregistered query.
+            m_cachedResultValidArray[GetQuerySlotIndex(rhiQueryIndices)] = false;
+
             // Create the RPI Query, and add it to the registry.
             auto* query = aznew RPI::Query(this, rhiQueryIndices, m_queryType, attachmentType, attachmentAccess);
             m_queryRegistry.emplace(query);
@@ -164,6 +178,52 @@ namespace AZ
             return resultCode == RHI::ResultCode::Success ? QueryResultCode::Success : QueryResultCode::Fail;
         }
 
+        void QueryPool::ResolveCachedResults()
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_queryRegistryMutex);
+
+            const uint32_t resultCount = m_queryResultSize / sizeof(uint64_t);
+            for (RPI::Query* query : m_queryRegistry)
+            {
+                // Get the RHI Query indices of the SubQuery that is ready for a non-blocking readback, if any.
+                const auto readyQueryIndices = query->GetReadySubQueryIndices();
+                if (!readyQueryIndices)
+                {
+                    continue;
+                }
+
+                // Resolve into the scratch buffer first, only committing it to the cache on success, so queries that
+                // aren't ready yet keep their previous cached result.
+                if (GetQueryResultFromIndices(m_resolveScratchArray.data(), readyQueryIndices.value(), RHI::QueryResultFlagBits::None) == QueryResultCode::Success)
+                {
+                    const uint32_t slotIndex = GetQuerySlotIndex(query->m_rhiQueryIndices);
+                    AZStd::copy(m_resolveScratchArray.begin(), m_resolveScratchArray.end(), m_cachedResultArray.begin() + slotIndex * resultCount);
+                    m_cachedResultValidArray[slotIndex] = true;
+                }
+            }
+        }
+
+        QueryResultCode QueryPool::GetCachedResult(const RHI::Interval& rhiQueryIndices, uint64_t* result)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_queryRegistryMutex);
+
+            const uint32_t slotIndex = GetQuerySlotIndex(rhiQueryIndices);
+            if (!m_cachedResultValidArray[slotIndex])
+            {
+                return QueryResultCode::Fail;
+            }
+
+            const uint32_t resultCount = m_queryResultSize / sizeof(uint64_t);
+            const auto cachedBegin = m_cachedResultArray.begin() + slotIndex * resultCount;
+            AZStd::copy(cachedBegin, cachedBegin + resultCount, result);
+            return QueryResultCode::Success;
+        }
+
+        uint32_t QueryPool::GetQuerySlotIndex(const RHI::Interval& rhiQueryIndices) const
+        {
+            return rhiQueryIndices.m_min / (m_queriesPerResult * RPI::Query::BufferedFrames);
+        }
+
         uint32_t QueryPool::GetQueryResultSize() const
         {
             return m_queryResultSize;
@@ -52,21 +52,22 @@ namespace AZ
 
         StreamingImageContextPtr DefaultStreamingImageController::CreateContextInternal()
         {
-            StreamingImageContextPtr context = aznew StreamingImageContext();
+            StreamingImageContextPtr context = aznew DefaultStreamingImageContext();
             m_recentlyAttachedContexts.emplace_back(context);
             return context;
         }
 
         void DefaultStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
         {
-            AZ_UNUSED(timestamp);
-            AZ_UNUSED(contexts);
-
             const uint32_t maxExpandsCount = 20;
             uint32_t mipsExpandsPerUpdate = 0;
 
-            // [GFX TODO] [ATOM-551] Streaming image control of DefaultStreamingImageController
-            // For now we always stream in all the mips. Of course we need to make this smarter at some point.
+            // The number of updates a coarser target must persist before the image is trimmed to it.
+            // Expansion is immediate, but trimming lags behind so that briefly occluded or off-screen
+            // surfaces don't evict mips they will need again a moment later.
+            const size_t trimHysteresisUpdateCount = 30;
+
+            // Newly attached images have no usage feedback yet, so start streaming all of their mips.
             if (!m_recentlyAttachedContexts.empty())
             {
                 for (auto& context : m_recentlyAttachedContexts)
@@ -83,6 +84,59 @@ namespace AZ
                 }
                 m_recentlyAttachedContexts.erase(m_recentlyAttachedContexts.begin(), m_recentlyAttachedContexts.begin() + mipsExpandsPerUpdate);
             }
+
+            // Follow the target mips reported through StreamingImage::SetTargetMip since the last update.
+            // Images with no feedback (many systems never report one) keep their current residency.
+            for (auto it = contexts.begin(); it != contexts.end(); ++it)
+            {
+                // Every context in this controller is created by CreateContextInternal above.
+                DefaultStreamingImageContext& context =
+                    static_cast<DefaultStreamingImageContext&>(const_cast<StreamingImageContext&>(*it));
+
+                StreamingImage* image = context.TryGetImage();
+                if (!image || !image->IsStreamable())
+                {
+                    continue;
+                }
+
+                const uint16_t targetMipLevel = context.GetTargetMip();
+                if (targetMipLevel >= RHI::Limits::Image::MipCountMax)
+                {
+                    continue;
+                }
+
+                const size_t mipChainTarget = GetMipChainIndexForMipLevel(image, targetMipLevel);
+
+                if (mipChainTarget < context.m_submittedMipChainTarget)
+                {
+                    // More detail was requested; expand right away (subject to the per-update budget).
+                    if (mipsExpandsPerUpdate < maxExpandsCount)
+                    {
+                        QueueExpandToMipChainLevel(image, mipChainTarget);
+                        context.m_submittedMipChainTarget = mipChainTarget;
+                        context.m_trimCandidateTimestamp = DefaultStreamingImageContext::InvalidTimestamp;
+                        mipsExpandsPerUpdate++;
+                    }
+                }
+                else if (mipChainTarget > context.m_submittedMipChainTarget)
+                {
+                    // Less detail was requested; only trim once the coarser target has persisted.
+                    if (context.m_trimCandidateTimestamp == DefaultStreamingImageContext::InvalidTimestamp)
+                    {
+                        context.m_trimCandidateTimestamp = timestamp;
+                    }
+                    else if (timestamp - context.m_trimCandidateTimestamp >= trimHysteresisUpdateCount)
+                    {
+                        TrimToMipChainLevel(image, mipChainTarget);
+                        context.m_submittedMipChainTarget = mipChainTarget;
+                        context.m_trimCandidateTimestamp = DefaultStreamingImageContext::InvalidTimestamp;
+                    }
+                }
+                else
+                {
+                    context.m_trimCandidateTimestamp = DefaultStreamingImageContext::InvalidTimestamp;
+                }
+            }
         }
     }
 }
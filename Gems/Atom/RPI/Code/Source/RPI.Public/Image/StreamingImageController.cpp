@@ -173,6 +173,13 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        size_t StreamingImageController::GetMipChainIndexForMipLevel(StreamingImage* image, uint16_t mipLevel) const
+        {
+            const StreamingImageAsset& imageAsset = *image->m_imageAsset;
+            const uint16_t mipLevelMax = static_cast<uint16_t>(imageAsset.GetImageDescriptor().m_mipLevels - 1);
+            return imageAsset.GetMipChainIndex(AZStd::min(mipLevel, mipLevelMax));
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
@@ -28,6 +28,46 @@ namespace AZ
             "(For Testing) Forces usage of root shader variant in the mesh draw packet level, ignoring any other shader variants that may exist."
         );
 
+        bool MeshDrawPacketCache::Key::operator==(const Key& rhs) const
+        {
+            return m_modelLod == rhs.m_modelLod
+                && m_meshIndex == rhs.m_meshIndex
+                && m_material == rhs.m_material
+                && m_shaderOptionsHash == rhs.m_shaderOptionsHash;
+        }
+
+        size_t MeshDrawPacketCache::KeyHasher::operator()(const Key& key) const
+        {
+            size_t seed = key.m_shaderOptionsHash;
+            AZStd::hash_combine(seed, key.m_modelLod);
+            AZStd::hash_combine(seed, key.m_meshIndex);
+            AZStd::hash_combine(seed, key.m_material);
+            return seed;
+        }
+
+        MeshDrawPacketCache::ConstEntryPtr MeshDrawPacketCache::Find(const Key& key, Material::ChangeId currentChangeId) const
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            auto iter = m_entries.find(key);
+            if (iter != m_entries.end() && iter->second->m_materialChangeId == currentChangeId)
+            {
+                return iter->second;
+            }
+            return nullptr;
+        }
+
+        void MeshDrawPacketCache::Insert(const Key& key, ConstEntryPtr entry)
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            m_entries[key] = AZStd::move(entry);
+        }
+
+        void MeshDrawPacketCache::Clear()
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            m_entries.clear();
+        }
+
         MeshDrawPacket::MeshDrawPacket(
             ModelLod& modelLod,
             size_t modelLodMeshIndex,
@@ -96,7 +136,7 @@ namespace AZ
             return true;
         }
 
-        bool MeshDrawPacket::Update(const Scene& parentScene, bool forceUpdate /*= false*/)
+        bool MeshDrawPacket::Update(const Scene& parentScene, bool forceUpdate /*= false*/, MeshDrawPacketCache* drawPacketCache /*= nullptr*/)
         {
             // Why we need to check "!m_material->NeedsCompile()"...
             //    Frame A:
@@ -114,7 +154,7 @@ namespace AZ
 
             if (forceUpdate || (!m_material->NeedsCompile() && m_materialChangeId != m_material->GetCurrentChangeId()))
             {
-                DoUpdate(parentScene);
+                DoUpdate(parentScene, drawPacketCache);
                 m_materialChangeId = m_material->GetCurrentChangeId();
                 return true;
             }
@@ -122,7 +162,7 @@ namespace AZ
             return false;
         }
 
-        bool MeshDrawPacket::DoUpdate(const Scene& parentScene)
+        bool MeshDrawPacket::DoUpdate(const Scene& parentScene, MeshDrawPacketCache* drawPacketCache)
         {
             const ModelLod::Mesh& mesh = m_modelLod->GetMeshes()[m_modelLodMeshIndex];
 
@@ -132,6 +172,37 @@ namespace AZ
                 return false;
             }
 
+            // Resolve the shaders for the material, reusing the shared cache entry when another instance
+            // with the same mesh/material/shader-option combination has already done the resolution.
+            MeshDrawPacketCache::ConstEntryPtr cacheEntry;
+            if (drawPacketCache)
+            {
+                const MeshDrawPacketCache::Key cacheKey = MakeCacheKey();
+                cacheEntry = drawPacketCache->Find(cacheKey, m_material->GetCurrentChangeId());
+                if (!cacheEntry)
+                {
+                    AZStd::shared_ptr<MeshDrawPacketCache::Entry> newEntry = AZStd::make_shared<MeshDrawPacketCache::Entry>();
+                    if (!BuildCacheEntry(parentScene, *newEntry))
+                    {
+                        return false;
+                    }
+                    cacheEntry = newEntry;
+                    drawPacketCache->Insert(cacheKey, cacheEntry);
+                }
+            }
+            else
+            {
+                AZStd::shared_ptr<MeshDrawPacketCache::Entry> localEntry = AZStd::make_shared<MeshDrawPacketCache::Entry>();
+                if (!BuildCacheEntry(parentScene, *localEntry))
+                {
+                    return false;
+                }
+                cacheEntry = localEntry;
+            }
+
+            // Assemble the per-instance draw packet from the resolved shader data. The object SRG (which
+            // carries this instance's objectId), the draw SRGs, the stencil ref and the sort key are unique
+            // per instance, so each instance still ends up with its own RHI::DrawPacket.
             RHI::DrawPacketBuilder drawPacketBuilder;
             drawPacketBuilder.Begin(nullptr);
 
@@ -143,15 +214,100 @@ namespace AZ
             // We build the list of used shaders in a local list rather than m_activeShaders so that
             // if DoUpdate() fails it won't modify any member data.
             MeshDrawPacket::ShaderList shaderList;
-            shaderList.reserve(m_activeShaders.size());
-
-            // We have to keep a list of these outside the loops that collect all the shaders because the DrawPacketBuilder
-            // keeps pointers to StreamBufferViews until DrawPacketBuilder::End() is called. And we use a fixed_vector to guarantee
-            // that the memory won't be relocated when new entries are added.
-            AZStd::fixed_vector<ModelLod::StreamBufferViewList, RHI::DrawPacketBuilder::DrawItemCountMax> streamBufferViewsPerShader;
+            shaderList.reserve(cacheEntry->m_shaderData.size());
 
             m_perDrawSrgs.clear();
 
+            for (const MeshDrawPacketCache::ShaderData& shaderData : cacheEntry->m_shaderData)
+            {
+                const Data::Instance<Shader>& shader = shaderData.m_shader;
+
+                auto drawSrgLayout = shader->GetAsset()->GetDrawSrgLayout(shader->GetSupervariantIndex());
+                Data::Instance<ShaderResourceGroup> drawSrg;
+                if (drawSrgLayout)
+                {
+                    // If the DrawSrg exists we must create and bind it, otherwise the CommandList will fail validation for SRG being null
+                    drawSrg = RPI::ShaderResourceGroup::Create(shader->GetAsset(), shader->GetSupervariantIndex(), drawSrgLayout->GetName());
+
+                    if (shaderData.m_needsShaderVariantKeyFallback && drawSrgLayout->HasShaderVariantKeyFallbackEntry())
+                    {
+                        drawSrg->SetShaderVariantKeyFallbackValue(shaderData.m_shaderVariantKeyFallback);
+                    }
+
+                    // Pass UvStreamTangentBitmask to the shader if the draw SRG has it.
+                    {
+                        AZ::Name shaderUvStreamTangentBitmask = AZ::Name(UvStreamTangentBitmask::SrgName);
+                        auto index = drawSrg->FindShaderInputConstantIndex(shaderUvStreamTangentBitmask);
+
+                        if (index.IsValid())
+                        {
+                            drawSrg->SetConstant(index, shaderData.m_uvStreamTangentBitmask.GetFullTangentBitmask());
+                        }
+                    }
+
+                    drawSrg->Compile();
+                }
+
+                RHI::DrawPacketBuilder::DrawRequest drawRequest;
+                drawRequest.m_listTag = shaderData.m_drawListTag;
+                drawRequest.m_pipelineState = shaderData.m_pipelineState;
+                drawRequest.m_streamBufferViews = shaderData.m_streamBufferViews;
+                drawRequest.m_stencilRef = m_stencilRef;
+                drawRequest.m_sortKey = m_sortKey;
+                if (drawSrg)
+                {
+                    drawRequest.m_uniqueShaderResourceGroup = drawSrg->GetRHIShaderResourceGroup();
+                    m_perDrawSrgs.push_back(drawSrg);
+                }
+                drawPacketBuilder.AddDrawItem(drawRequest);
+
+                shaderList.emplace_back(shader);
+            }
+
+            m_drawPacket = drawPacketBuilder.End();
+
+            if (m_drawPacket)
+            {
+                m_activeShaders = shaderList;
+                m_materialSrg = m_material->GetRHIShaderResourceGroup();
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        MeshDrawPacketCache::Key MeshDrawPacket::MakeCacheKey() const
+        {
+            size_t shaderOptionsHash = 0;
+            for (const ShaderOptionPair& shaderOption : m_shaderOptions)
+            {
+                AZStd::hash_combine(shaderOptionsHash, shaderOption.first.GetHash());
+                AZStd::hash_combine(shaderOptionsHash, shaderOption.second.GetIndex());
+            }
+
+            // The uv override map affects stream selection, so it contributes to the key as well. The map is
+            // unordered, so the per-element hashes are summed to stay independent of iteration order.
+            size_t uvMapHash = 0;
+            for (const auto& uvOverride : m_materialModelUvMap)
+            {
+                size_t elementHash = uvOverride.first.GetHash();
+                AZStd::hash_combine(elementHash, uvOverride.second.GetHash());
+                uvMapHash += elementHash;
+            }
+            AZStd::hash_combine(shaderOptionsHash, uvMapHash);
+
+            MeshDrawPacketCache::Key key;
+            key.m_modelLod = m_modelLod.get();
+            key.m_meshIndex = m_modelLodMeshIndex;
+            key.m_material = m_material.get();
+            key.m_shaderOptionsHash = shaderOptionsHash;
+            return key;
+        }
+
+        bool MeshDrawPacket::BuildCacheEntry(const Scene& parentScene, MeshDrawPacketCache::Entry& entry)
+        {
             auto appendShader = [&](const ShaderCollection::Item& shaderItem)
             {
                 // Skip the shader item without creating the shader instance
@@ -232,72 +388,38 @@ namespace AZ
                 const RHI::RenderStates& renderStatesOverlay = *shaderItem.GetRenderStatesOverlay();
                 RHI::MergeStateInto(renderStatesOverlay, pipelineStateDescriptor.m_renderStates);
 
-                streamBufferViewsPerShader.push_back();
-                auto& streamBufferViews = streamBufferViewsPerShader.back();
-
-                UvStreamTangentBitmask uvStreamTangentBitmask;
+                // Fill the shader data in place so the stream buffer views live in the entry's stable storage.
+                entry.m_shaderData.push_back();
+                MeshDrawPacketCache::ShaderData& shaderData = entry.m_shaderData.back();
 
                 if (!m_modelLod->GetStreamsForMesh(
                     pipelineStateDescriptor.m_inputStreamLayout,
-                    streamBufferViews,
-                    &uvStreamTangentBitmask,
+                    shaderData.m_streamBufferViews,
+                    &shaderData.m_uvStreamTangentBitmask,
                     shader->GetInputContract(),
                     m_modelLodMeshIndex,
                     m_materialModelUvMap,
                     m_material->GetAsset()->GetMaterialTypeAsset()->GetUvNameMap()))
                 {
+                    entry.m_shaderData.pop_back();
                     return false;
                 }
 
-                auto drawSrgLayout = shader->GetAsset()->GetDrawSrgLayout(shader->GetSupervariantIndex());
-                Data::Instance<ShaderResourceGroup> drawSrg;
-                if (drawSrgLayout)
-                {
-                    // If the DrawSrg exists we must create and bind it, otherwise the CommandList will fail validation for SRG being null
-                    drawSrg = RPI::ShaderResourceGroup::Create(shader->GetAsset(), shader->GetSupervariantIndex(), drawSrgLayout->GetName());
-
-                    if (!variant.IsFullyBaked() && drawSrgLayout->HasShaderVariantKeyFallbackEntry())
-                    {
-                        drawSrg->SetShaderVariantKeyFallbackValue(shaderOptions.GetShaderVariantKeyFallbackValue());
-                    }
-
-                    // Pass UvStreamTangentBitmask to the shader if the draw SRG has it.
-                    {
-                        AZ::Name shaderUvStreamTangentBitmask = AZ::Name(UvStreamTangentBitmask::SrgName);
-                        auto index = drawSrg->FindShaderInputConstantIndex(shaderUvStreamTangentBitmask);
-
-                        if (index.IsValid())
-                        {
-                            drawSrg->SetConstant(index, uvStreamTangentBitmask.GetFullTangentBitmask());
-                        }
-                    }
-
-                    drawSrg->Compile();
-                }
-
                 parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
 
                 const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
                 if (!pipelineState)
                 {
                     AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to acquire default pipeline state", shaderItem.GetShaderAsset()->GetName().GetCStr());
+                    entry.m_shaderData.pop_back();
                     return false;
                 }
 
-                RHI::DrawPacketBuilder::DrawRequest drawRequest;
-                drawRequest.m_listTag = drawListTag;
-                drawRequest.m_pipelineState = pipelineState;
-                drawRequest.m_streamBufferViews = streamBufferViews;
-                drawRequest.m_stencilRef = m_stencilRef;
-                drawRequest.m_sortKey = m_sortKey;
-                if (drawSrg)
-                {
-                    drawRequest.m_uniqueShaderResourceGroup = drawSrg->GetRHIShaderResourceGroup();
-                    m_perDrawSrgs.push_back(drawSrg);
-                }
-                drawPacketBuilder.AddDrawItem(drawRequest);
-
-                shaderList.emplace_back(AZStd::move(shader));
+                shaderData.m_drawListTag = drawListTag;
+                shaderData.m_pipelineState = pipelineState;
+                shaderData.m_needsShaderVariantKeyFallback = !variant.IsFullyBaked();
+                shaderData.m_shaderVariantKeyFallback = shaderOptions.GetShaderVariantKeyFallbackValue();
+                shaderData.m_shader = AZStd::move(shader);
 
                 return true;
             };
@@ -319,7 +441,7 @@ namespace AZ
             {
                 if (shaderItem.IsEnabled())
                 {
-                    if (shaderList.size() == RHI::DrawPacketBuilder::DrawItemCountMax)
+                    if (entry.m_shaderData.size() == RHI::DrawPacketBuilder::DrawItemCountMax)
                     {
                         AZ_Error("MeshDrawPacket", false, "Material has more than the limit of %d active shader items.", RHI::DrawPacketBuilder::DrawItemCountMax);
                         return false;
@@ -329,18 +451,13 @@ namespace AZ
                 }
             }
 
-            m_drawPacket = drawPacketBuilder.End();
+            // Record the identity and change id the entry was built against, after SetSystemShaderOption
+            // above has had the chance to bump the material's change id.
+            entry.m_modelLod = m_modelLod;
+            entry.m_material = m_material;
+            entry.m_materialChangeId = m_material->GetCurrentChangeId();
 
-            if (m_drawPacket)
-            {
-                m_activeShaders = shaderList;
-                m_materialSrg = m_material->GetRHIShaderResourceGroup();
-                return true;
-            }
-            else
-            {
-                return false;
-            }
+            return true;
         }
 
         const RHI::DrawPacket* MeshDrawPacket::GetRHIDrawPacket() const
@@ -117,6 +117,7 @@ namespace AZ
             m_dispatchItem.m_arguments = dispatchArgs;
 
             m_isFullscreenPass = passData->m_makeFullscreenPass;
+            m_useAsyncCompute = passData->m_useAsyncCompute;
 
             // Setup pipeline state...
             RHI::PipelineStateDescriptorForDispatch pipelineStateDescriptor;
@@ -135,6 +136,10 @@ namespace AZ
         {
             RenderPass::SetupFrameGraphDependencies(frameGraph);
             frameGraph.SetEstimatedItemCount(1);
+            if (m_useAsyncCompute)
+            {
+                frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Compute);
+            }
         }
 
         void ComputePass::CompileResources(const RHI::FrameGraphCompileContext& context)
@@ -156,6 +156,11 @@ namespace AZ
 
                 m_pipelineLibraryHandle = pipelineLibraryHandle;
                 m_pipelineStateCache = pipelineStateCache;
+
+                if (auto* shaderSystem = ShaderSystemInterface::Get())
+                {
+                    shaderSystem->RegisterShader(this);
+                }
             }
 
             const Name& drawListName = shaderAsset.GetDrawListName();
@@ -182,6 +187,11 @@ namespace AZ
 
             if (m_pipelineLibraryHandle.IsValid())
             {
+                if (auto* shaderSystem = ShaderSystemInterface::Get())
+                {
+                    shaderSystem->UnregisterShader(this);
+                }
+
                 SavePipelineLibrary();
 
                 m_pipelineStateCache->ReleaseLibrary(m_pipelineLibraryHandle);
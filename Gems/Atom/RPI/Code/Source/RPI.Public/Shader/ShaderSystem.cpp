@@ -95,6 +95,7 @@ namespace AZ
         {
             ShaderReloadDebugTracker::Shutdown();
             Data::InstanceDatabase<Shader>::Destroy();
+            AZ_Warning("ShaderSystem", m_shaders.empty(), "Shutting down the ShaderSystem, but there are still registered shader instances.");
             Data::InstanceDatabase<ShaderResourceGroup>::Destroy();
             Data::InstanceDatabase<ShaderResourceGroupPool>::Destroy();
             Interface<ShaderSystemInterface>::Unregister(this);
@@ -156,7 +157,33 @@ namespace AZ
         {
             return m_supervariantName;
         }
+
+        void ShaderSystem::RegisterShader(Shader* shader)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_shadersMutex);
+            m_shaders.insert(shader);
+        }
+
+        void ShaderSystem::UnregisterShader(Shader* shader)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_shadersMutex);
+            m_shaders.erase(shader);
+        }
+
+        void ShaderSystem::SavePipelineLibraries()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_shadersMutex);
+            for (Shader* shader : m_shaders)
+            {
+                shader->SavePipelineLibrary();
+            }
+        }
         ///////////////////////////////////////////////////////////////////
 
+        void ShaderSystem::SavePipelineLibrariesCommand([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            SavePipelineLibraries();
+        }
+
     } // namespace RPI
 } // namespace AZ
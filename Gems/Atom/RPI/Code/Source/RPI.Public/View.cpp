@@ -112,6 +112,12 @@ namespace AZ
             AddDrawPacket(drawPacket, depth);
         }
 
+        void View::AddVisibleDrawPackets(AZStd::array_view<RHI::DrawPacketProperties> drawPackets)
+        {
+            // This function is thread safe since DrawListContent has storage per thread for draw item data.
+            m_drawListContext.AddDrawPackets(drawPackets);
+        }
+
         void View::AddDrawItem(RHI::DrawListTag drawListTag, const RHI::DrawItemProperties& drawItemProperties)
         {
             m_drawListContext.AddDrawItem(drawListTag, drawItemProperties);
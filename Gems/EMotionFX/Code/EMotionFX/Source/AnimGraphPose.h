@@ -10,6 +10,7 @@
 
 // include required headers
 #include "EMotionFXConfig.h"
+#include "Allocators.h"
 #include "Pose.h"
 
 
@@ -27,6 +28,8 @@ namespace EMotionFX
         MCORE_MEMORYOBJECTCATEGORY(AnimGraphPose, EMFX_DEFAULT_ALIGNMENT, EMFX_MEMCATEGORY_ANIMGRAPH_POSE);
 
     public:
+        AZ_CLASS_ALLOCATOR(AnimGraphPose, AnimGraphAllocator, 0)
+
         enum
         {
             FLAG_INUSE      = 1 << 0
@@ -61,7 +61,7 @@ namespace EMotionFX
             const size_t numToAdd = numPoses - numOldPoses;
             for (size_t i = 0; i < numToAdd; ++i)
             {
-                AnimGraphPose* newPose = new AnimGraphPose();
+                AnimGraphPose* newPose = aznew AnimGraphPose();
                 m_poses.emplace_back(newPose);
                 m_freePoses.emplace_back(newPose);
             }
@@ -75,7 +75,7 @@ namespace EMotionFX
         // if we have no free poses left, allocate a new one
         if (m_freePoses.empty())
         {
-            AnimGraphPose* newPose = new AnimGraphPose();
+            AnimGraphPose* newPose = aznew AnimGraphPose();
             newPose->LinkToActorInstance(actorInstance);
             m_poses.emplace_back(newPose);
             m_maxUsed = AZStd::max(m_maxUsed, GetNumUsedPoses());
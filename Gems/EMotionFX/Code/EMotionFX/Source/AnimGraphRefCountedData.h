@@ -10,6 +10,7 @@
 
 // include required headers
 #include "EMotionFXConfig.h"
+#include "Allocators.h"
 #include "AnimGraphEventBuffer.h"
 #include "Transform.h"
 
@@ -26,6 +27,8 @@ namespace EMotionFX
         MCORE_MEMORYOBJECTCATEGORY(AnimGraphRefCountedData, EMFX_DEFAULT_ALIGNMENT, EMFX_MEMCATEGORY_ANIMGRAPH_REFCOUNTEDDATA);
 
     public:
+        AZ_CLASS_ALLOCATOR(AnimGraphRefCountedData, AnimGraphObjectDataAllocator, 0)
+
         MCORE_INLINE AnimGraphRefCountedData() = default;
         MCORE_INLINE ~AnimGraphRefCountedData() = default;
 
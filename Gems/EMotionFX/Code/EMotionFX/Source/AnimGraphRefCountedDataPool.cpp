@@ -62,7 +62,7 @@ namespace EMotionFX
             const size_t numToAdd = numItems - numOldItems;
             for (size_t i = 0; i < numToAdd; ++i)
             {
-                AnimGraphRefCountedData* newItem = new AnimGraphRefCountedData();
+                AnimGraphRefCountedData* newItem = aznew AnimGraphRefCountedData();
                 m_items.emplace_back(newItem);
                 m_freeItems.emplace_back(newItem);
             }
@@ -76,7 +76,7 @@ namespace EMotionFX
         // if we have no free items left, allocate a new one
         if (m_freeItems.empty())
         {
-            AnimGraphRefCountedData* newItem = new AnimGraphRefCountedData();
+            AnimGraphRefCountedData* newItem = aznew AnimGraphRefCountedData();
             m_items.emplace_back(newItem);
             m_maxUsed = AZStd::max(m_maxUsed, GetNumUsedItems());
             return newItem;
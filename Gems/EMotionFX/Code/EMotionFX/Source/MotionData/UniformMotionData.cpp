@@ -211,10 +211,11 @@ namespace EMotionFX
         const ActorInstance* actorInstance = settings.m_actorInstance;
         const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
         const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        const size_t motionExtractionNodeIndex = settings.m_inPlace ? actor->GetMotionExtractionNodeIndex() : InvalidIndex;
         for (size_t i = 0; i < numNodes; ++i)
         {
             const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
-            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+            const bool inPlace = (skeletonJointIndex == motionExtractionNodeIndex);
 
             // Sample the interpolated data.
             Transform result;
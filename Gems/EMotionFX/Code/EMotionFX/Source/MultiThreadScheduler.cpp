@@ -146,15 +146,16 @@ namespace EMotionFX
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
 
+        // create one update job per enabled actor instance
+        // the schedule steps are only used to track which actor instances are scheduled, dependencies between
+        // actor instances are expressed as explicit job edges along the attachment hierarchy instead, so that
+        // independent actor instances never wait on each other
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobCompletion jobCompletion;
+        AZStd::unordered_map<ActorInstance*, AZ::Job*> actorInstanceJobs;
+
         for (const ScheduleStep& currentStep : m_steps)
         {
-            if (currentStep.m_actorInstances.empty())
-            {
-                continue;
-            }
-
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;
             for (ActorInstance* actorInstance : currentStep.m_actorInstances)
             {
                 if (actorInstance->GetIsEnabled() == false)
@@ -162,12 +163,11 @@ namespace EMotionFX
                     continue;
                 }
 
-                AZ::JobContext* jobContext = nullptr;
                 AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
                 {
                     AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
+                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
                     actorInstance->SetThreadIndex(threadIndex);
 
                     const bool isVisible = actorInstance->GetIsVisible();
@@ -194,14 +194,57 @@ namespace EMotionFX
                     actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
                 }, true, jobContext);
 
-                job->SetDependent(&jobCompletion);               
-                job->Start();
+                job->SetDependent(&jobCompletion);
+                actorInstanceJobs.emplace(actorInstance, job);
 
                 m_numUpdated.Increment();
             }
+        }
+
+        if (actorInstanceJobs.empty())
+        {
+            return;
+        }
+
+        // wire up the per-attachment dependency edges, which has to happen before starting any of the jobs
+        for (const auto& actorInstanceJob : actorInstanceJobs)
+        {
+            AddAttachmentDependencies(actorInstanceJob.first, actorInstanceJob.second, actorInstanceJobs);
+        }
+
+        // kick off all jobs, jobs with dependency edges only run once the jobs they depend on completed
+        for (const auto& actorInstanceJob : actorInstanceJobs)
+        {
+            actorInstanceJob.second->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    // link the update job of an actor instance to the update jobs of its attachments
+    void MultiThreadScheduler::AddAttachmentDependencies(ActorInstance* actorInstance, AZ::Job* job, const AZStd::unordered_map<ActorInstance*, AZ::Job*>& actorInstanceJobs) const
+    {
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (!attachment)
+            {
+                continue;
+            }
 
-            jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
+            const auto jobIter = actorInstanceJobs.find(attachment);
+            if (jobIter != actorInstanceJobs.end())
+            {
+                job->SetDependent(jobIter->second);
+            }
+            else
+            {
+                // the attachment doesn't update this frame, but its own attachments might
+                AddAttachmentDependencies(attachment, job, actorInstanceJobs);
+            }
+        }
     }
 
 
@@ -13,6 +13,12 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace AZ
+{
+    class Job;
+}
 
 namespace EMotionFX
 {
@@ -166,5 +172,16 @@ namespace EMotionFX
          * @param outStep The scheduler step to add the dependencies to.
          */
         void AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep);
+
+        /**
+         * Link the update job of an actor instance to the update jobs of its attachments, so that an attachment
+         * only starts updating once the actor instance it is attached to finished updating its transforms.
+         * Attachments without an update job (for example disabled ones) are recursed through, so their own
+         * attachments still update after the given actor instance.
+         * @param actorInstance The actor instance whose attachments to link.
+         * @param job The update job of the given actor instance.
+         * @param actorInstanceJobs The update jobs of all actor instances that update this frame.
+         */
+        void AddAttachmentDependencies(ActorInstance* actorInstance, AZ::Job* job, const AZStd::unordered_map<ActorInstance*, AZ::Job*>& actorInstanceJobs) const;
     };
 }   // namespace EMotionFX
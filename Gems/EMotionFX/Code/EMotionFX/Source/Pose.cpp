@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/std/algorithm.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionInstance.h>
@@ -427,6 +428,20 @@ namespace EMotionFX
     }
 
 
+    // check if the local space transforms of all nodes are ready to use, so that no lazy updates are pending
+    bool Pose::AreAllLocalTransformsReady() const
+    {
+        return AZStd::all_of(m_flags.begin(), m_flags.end(), [](uint8 flags) { return (flags & FLAG_LOCALTRANSFORMREADY) != 0; });
+    }
+
+
+    // check if any node has an up to date model space transform
+    bool Pose::HasAnyModelSpaceTransformReady() const
+    {
+        return AZStd::any_of(m_flags.begin(), m_flags.end(), [](uint8 flags) { return (flags & FLAG_MODELTRANSFORMREADY) != 0; });
+    }
+
+
     Transform Pose::CalcTrajectoryTransform() const
     {
         MCORE_ASSERT(m_actor);
@@ -453,6 +468,15 @@ namespace EMotionFX
 
     void Pose::UpdateAllModelSpaceTranforms()
     {
+        // when no model space transform is up to date yet, which is the common case right after overwriting the
+        // local space pose (blends invalidate all model space transforms), run the tight full update kernel over
+        // the contiguous transform arrays instead of the recursive per-node ready-flag walk
+        if (AreAllLocalTransformsReady() && !HasAnyModelSpaceTransformReady())
+        {
+            ForceUpdateFullModelSpacePose();
+            return;
+        }
+
         Skeleton* skeleton = m_actor->GetSkeleton();
         const size_t numNodes = skeleton->GetNumNodes();
         for (size_t i = 0; i < numNodes; ++i)
@@ -786,13 +810,29 @@ namespace EMotionFX
         if (m_actorInstance)
         {
             const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
+            if (numNodes == m_localSpaceTransforms.size() &&
+                other->m_localSpaceTransforms.size() == numNodes &&
+                AreAllLocalTransformsReady() &&
+                other->AreAllLocalTransformsReady())
+            {
+                // batch path over the contiguous transform arrays, see Pose::Blend
+                Transform* transforms = m_localSpaceTransforms.data();
+                const Transform* otherTransforms = other->m_localSpaceTransforms.data();
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    transforms[i].Add(otherTransforms[i], weight);
+                }
+            }
+            else
             {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
 
-                Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                const Transform& otherTransform = other->GetLocalSpaceTransform(nodeNr);
-                transform.Add(otherTransform, weight);
+                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
+                    const Transform& otherTransform = other->GetLocalSpaceTransform(nodeNr);
+                    transform.Add(otherTransform, weight);
+                }
             }
 
             // blend the morph weights
@@ -834,11 +874,29 @@ namespace EMotionFX
         if (m_actorInstance)
         {
             const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
+            if (numNodes == m_localSpaceTransforms.size() &&
+                destPose->m_localSpaceTransforms.size() == numNodes &&
+                AreAllLocalTransformsReady() &&
+                destPose->AreAllLocalTransformsReady())
+            {
+                // no nodes are disabled and no lazy local space updates are pending on either pose, so blend the
+                // contiguous transform arrays directly, which skips the per-joint enabled-node indirection and
+                // ready-flag checks and keeps multiple joints in flight per loop iteration
+                Transform* transforms = m_localSpaceTransforms.data();
+                const Transform* destTransforms = destPose->m_localSpaceTransforms.data();
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    transforms[i].Blend(destTransforms[i], weight);
+                }
+            }
+            else
             {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
+                    Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
+                    curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
+                }
             }
 
             // blend the morph weights
@@ -859,10 +917,24 @@ namespace EMotionFX
         else
         {
             const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
-            for (size_t i = 0; i < numNodes; ++i)
+            if (destPose->m_localSpaceTransforms.size() == numNodes &&
+                AreAllLocalTransformsReady() &&
+                destPose->AreAllLocalTransformsReady())
             {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
+                Transform* transforms = m_localSpaceTransforms.data();
+                const Transform* destTransforms = destPose->m_localSpaceTransforms.data();
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    transforms[i].Blend(destTransforms[i], weight);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
+                    curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
+                }
             }
 
             // blend the morph weights
@@ -944,18 +1016,41 @@ namespace EMotionFX
             if (m_actorInstance)
             {
                 const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-                for (size_t i = 0; i < numNodes; ++i)
+                if (numNodes == m_localSpaceTransforms.size() &&
+                    AreAllLocalTransformsReady() &&
+                    additivePose.AreAllLocalTransformsReady())
                 {
-                    uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
-                    transform.m_position += additiveTransform.m_position * weight;
-                    transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
-                    )
-                    transform.m_rotation.Normalize();
+                    // batch path over the contiguous transform arrays, see Pose::Blend
+                    Transform* transforms = m_localSpaceTransforms.data();
+                    const Transform* additiveTransforms = additivePose.m_localSpaceTransforms.data();
+                    for (size_t i = 0; i < numNodes; ++i)
+                    {
+                        Transform& transform = transforms[i];
+                        const Transform& additiveTransform = additiveTransforms[i];
+                        transform.m_position += additiveTransform.m_position * weight;
+                        transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
+                        EMFX_SCALECODE
+                        (
+                            transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
+                        )
+                        transform.m_rotation.Normalize();
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < numNodes; ++i)
+                    {
+                        uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
+                        Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
+                        const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
+                        transform.m_position += additiveTransform.m_position * weight;
+                        transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
+                        EMFX_SCALECODE
+                        (
+                            transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
+                        )
+                        transform.m_rotation.Normalize();
+                    }
                 }
             }
             else
@@ -994,18 +1089,41 @@ namespace EMotionFX
         if (m_actorInstance)
         {
             const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
+            if (numNodes == m_localSpaceTransforms.size() &&
+                AreAllLocalTransformsReady() &&
+                additivePose.AreAllLocalTransformsReady())
             {
-                uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
-                transform.m_position += additiveTransform.m_position;
-                transform.m_rotation = transform.m_rotation * additiveTransform.m_rotation;
-                EMFX_SCALECODE
-                (
-                    transform.m_scale *= additiveTransform.m_scale;
-                )
-                transform.m_rotation.Normalize();
+                // batch path over the contiguous transform arrays, see Pose::Blend
+                Transform* transforms = m_localSpaceTransforms.data();
+                const Transform* additiveTransforms = additivePose.m_localSpaceTransforms.data();
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    Transform& transform = transforms[i];
+                    const Transform& additiveTransform = additiveTransforms[i];
+                    transform.m_position += additiveTransform.m_position;
+                    transform.m_rotation = transform.m_rotation * additiveTransform.m_rotation;
+                    EMFX_SCALECODE
+                    (
+                        transform.m_scale *= additiveTransform.m_scale;
+                    )
+                    transform.m_rotation.Normalize();
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < numNodes; ++i)
+                {
+                    uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
+                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
+                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
+                    transform.m_position += additiveTransform.m_position;
+                    transform.m_rotation = transform.m_rotation * additiveTransform.m_rotation;
+                    EMFX_SCALECODE
+                    (
+                        transform.m_scale *= additiveTransform.m_scale;
+                    )
+                    transform.m_rotation.Normalize();
+                }
             }
         }
         else
@@ -208,6 +208,18 @@ namespace EMotionFX
 
         void RecursiveInvalidateModelSpaceTransforms(const Actor* actor, size_t nodeIndex);
 
+        /**
+         * Check if the local space transforms of all nodes are ready to use, so that no lazy updates are pending.
+         * When this is the case, batch operations can run directly over the contiguous transform arrays without
+         * the per-node ready-flag checks of GetLocalSpaceTransform().
+         */
+        bool AreAllLocalTransformsReady() const;
+
+        /**
+         * Check if any node has an up to date model space transform.
+         */
+        bool HasAnyModelSpaceTransformReady() const;
+
         /**
          * Perform a non-mixed blend into the specified destination pose.
          * @param destPose The destination pose to blend into.
@@ -63,7 +63,9 @@ MCORE_INLINE void TCompressedQuaternion<StorageType>::UnCompress(AZ::Quaternion*
 template <>
 MCORE_INLINE void TCompressedQuaternion<int16>::UnCompress(AZ::Quaternion* output) const
 {
-    output->Set(m_x * 0.000030518509448f, m_y * 0.000030518509448f, m_z * 0.000030518509448f, m_w * 0.000030518509448f);
+    // decode all four components at once: sign extend to 32 bit integers, convert to floats and scale by 1/32767
+    const AZ::Simd::Vec4::Int32Type packed = AZ::Simd::Vec4::LoadImmediate(m_x, m_y, m_z, m_w);
+    *output = AZ::Quaternion(AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::ConvertToFloat(packed), AZ::Simd::Vec4::Splat(0.000030518509448f)));
 }
 
 
@@ -80,5 +82,7 @@ MCORE_INLINE AZ::Quaternion TCompressedQuaternion<StorageType>::ToQuaternion() c
 template <>
 MCORE_INLINE AZ::Quaternion TCompressedQuaternion<int16>::ToQuaternion() const
 {
-    return AZ::Quaternion(m_x * 0.000030518509448f, m_y * 0.000030518509448f, m_z * 0.000030518509448f, m_w * 0.000030518509448f);
+    // decode all four components at once: sign extend to 32 bit integers, convert to floats and scale by 1/32767
+    const AZ::Simd::Vec4::Int32Type packed = AZ::Simd::Vec4::LoadImmediate(m_x, m_y, m_z, m_w);
+    return AZ::Quaternion(AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::ConvertToFloat(packed), AZ::Simd::Vec4::Splat(0.000030518509448f)));
 }
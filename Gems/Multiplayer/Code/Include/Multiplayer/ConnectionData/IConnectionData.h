@@ -39,8 +39,14 @@ namespace Multiplayer
         //! @return reference to the EntityReplicationManager for this connection data instance
         virtual EntityReplicationManager& GetReplicationManager() = 0;
 
-        //! Creates and manages sending updates to the remote endpoint.
-        virtual void Update() = 0;
+        //! Generates the entity update messages pending for the remote endpoint without sending them.
+        //! Generation only reads entity state, so different connections may generate their updates
+        //! concurrently on worker threads.
+        virtual void GenerateUpdates() = 0;
+
+        //! Sends the updates generated by GenerateUpdates to the remote endpoint.
+        //! Transmission mutates connection and socket state, so this must run on the network tick thread.
+        virtual void SendUpdates() = 0;
 
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
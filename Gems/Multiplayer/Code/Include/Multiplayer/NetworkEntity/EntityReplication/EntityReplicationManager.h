@@ -60,7 +60,16 @@ namespace Multiplayer
         const HostId& GetRemoteHostId() const;
 
         void ActivatePendingEntities();
-        void SendUpdates();
+
+        //! Serializes all pending entity updates for this connection into update packets, without sending them.
+        //! Generation only reads entity state and mutates per-connection bookkeeping, so different connections
+        //! may generate their update packets concurrently on worker threads.
+        void GenerateUpdatePackets();
+
+        //! Sends the update packets produced by GenerateUpdatePackets, along with any deferred rpcs.
+        //! Transmission mutates shared connection and socket state, so this must run on the network tick thread.
+        void SendGeneratedUpdatePackets();
+
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -120,7 +129,7 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        void GenerateEntityUpdateMessages(EntityReplicatorList& replicatorList);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -188,6 +197,15 @@ namespace Multiplayer
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
 
+        //! A single update packet worth of serialized entity updates, generated during GenerateUpdatePackets
+        //! and transmitted during SendGeneratedUpdatePackets
+        struct GeneratedUpdatePacket
+        {
+            NetworkEntityUpdateVector m_entityUpdates;
+            EntityReplicatorList m_updatedReplicators;
+        };
+        AZStd::vector<GeneratedUpdatePacket> m_generatedUpdatePackets;
+
         AZ::Event<NetEntityId> m_autonomousEntityReplicatorCreated;
         EntityExitDomainEvent::Handler m_entityExitDomainEventHandler;
         SendMigrateEntityEvent m_sendMigrateEntityEvent;
@@ -207,6 +225,8 @@ namespace Multiplayer
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
+        uint32_t m_sendBudgetBytes = 0;
+        uint32_t m_sendBudgetBytesUsed = 0;
         Mode m_updateMode = Mode::Invalid;
 
         friend class EntityReplicator;
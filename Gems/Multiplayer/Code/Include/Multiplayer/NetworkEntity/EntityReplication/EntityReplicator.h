@@ -68,6 +68,11 @@ namespace Multiplayer
         NetworkEntityUpdateMessage GenerateUpdatePacket();
         void FinalizeSerialization(AzNetworking::PacketId sentId);
 
+        // Interface for ReplicationManager to schedule sends by priority under a bandwidth budget
+        void AccumulateSendPriority(float priority);
+        float GetAccumulatedSendPriority() const;
+        void ClearAccumulatedSendPriority();
+
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
         PropertyPublisher* GetPropertyPublisher();
@@ -136,6 +141,8 @@ namespace Multiplayer
         NetEntityRole m_boundLocalNetworkRole;
         NetEntityRole m_remoteNetworkRole;
 
+        float m_accumulatedSendPriority = 0.0f;
+
         bool m_wasMigrated = false;
         bool m_isForwardingRpc = false;
         bool m_prefabEntityIdSet = false;
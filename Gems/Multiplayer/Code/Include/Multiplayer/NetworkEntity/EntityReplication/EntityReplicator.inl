@@ -30,6 +30,21 @@ namespace Multiplayer
         return m_netBindComponent;
     }
 
+    inline void EntityReplicator::AccumulateSendPriority(float priority)
+    {
+        m_accumulatedSendPriority += priority;
+    }
+
+    inline float EntityReplicator::GetAccumulatedSendPriority() const
+    {
+        return m_accumulatedSendPriority;
+    }
+
+    inline void EntityReplicator::ClearAccumulatedSendPriority()
+    {
+        m_accumulatedSendPriority = 0.0f;
+    }
+
     inline const PrefabEntityId& EntityReplicator::GetPrefabEntityId() const
     {
         AZ_Assert(IsPrefabEntityIdSet(), "PrefabEntityId not set for Entity");
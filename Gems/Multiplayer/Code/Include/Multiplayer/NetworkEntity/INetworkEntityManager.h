@@ -19,6 +19,7 @@ namespace Multiplayer
 {
     class NetworkEntityTracker;
     class NetworkEntityAuthorityTracker;
+    class NetworkEntitySpatialMap;
     class NetworkEntityRpcMessage;
     class MultiplayerComponentRegistry;
     class IEntityDomain;
@@ -60,6 +61,10 @@ namespace Multiplayer
         //! @return the NetworkEntityAuthorityTracker for this INetworkEntityManager instance
         virtual NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() = 0;
 
+        //! Returns the shared spatial map of all networked entities, rebuilding it first if it has gone stale.
+        //! @return the shared spatial map of all networked entities
+        virtual NetworkEntitySpatialMap* GetNetworkEntitySpatialMap() = 0;
+
         //! Returns the MultiplayerComponentRegistry for this INetworkEntityManager instance.
         //! @return the MultiplayerComponentRegistry for this INetworkEntityManager instance
         virtual MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() = 0;
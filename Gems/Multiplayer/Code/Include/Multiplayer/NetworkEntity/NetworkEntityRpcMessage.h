@@ -76,6 +76,8 @@ namespace Multiplayer
         bool GetRpcParams(IRpcParamStruct& outParams);
 
         //! Base serialize method for all serializable structures or classes to implement.
+        //! Dispatches once to the concrete serializer type so field serialization on the hot
+        //! wire serializers compiles to direct calls, tooling serializers use the virtual interface.
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
@@ -90,6 +92,9 @@ namespace Multiplayer
 
     private:
 
+        template <typename Serializer>
+        bool SerializeDetail(Serializer& serializer);
+
         // Serialized payload data
         RpcDeliveryType m_rpcDeliveryType = RpcDeliveryType::None;
         NetEntityId     m_entityId        = InvalidNetEntityId;
@@ -95,12 +95,17 @@ namespace Multiplayer
         AzNetworking::PacketEncodingBuffer& ModifyData();
 
         //! Base serialize method for all serializable structures or classes to implement.
+        //! Dispatches once to the concrete serializer type so field serialization on the hot
+        //! wire serializers compiles to direct calls, tooling serializers use the virtual interface.
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
     private:
 
+        template <typename Serializer>
+        bool SerializeDetail(Serializer& serializer);
+
         NetEntityRole  m_networkRole = NetEntityRole::InvalidRole;
         NetEntityId    m_entityId = InvalidNetEntityId;
         bool           m_isDelete = false;
@@ -8,12 +8,22 @@
 
 #pragma once
 
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace Multiplayer
 {
+    //! A single entity hit by a rewound raycast, along with the distance along the ray it was hit at.
+    struct RewindRaycastHit
+    {
+        NetEntityId m_entityId = InvalidNetEntityId;
+        float m_hitDistance = 0.0f;
+    };
+    using RewindRaycastHits = AZStd::vector<RewindRaycastHit>;
+
     //! @class INetworkTime
     //! @brief This is an AZ::Interface<> for managing multiplayer specific time related operations.
     class INetworkTime
@@ -64,6 +74,15 @@ namespace Multiplayer
         //! @param rewindConnectionId the rewinding ConnectionId 
         virtual void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) = 0;
 
+        //! Casts a ray against the rewound bounds of all networked entities at the current rewound time.
+        //! This resolves directly against snapshotted entity state, no live entities are repositioned.
+        //! @param start       the world space start point of the ray
+        //! @param direction   the normalized direction of the ray
+        //! @param maxDistance the maximum hit distance to consider
+        //! @param outHits     filled with all hit entities, sorted nearest first
+        //! @return true if at least one entity was hit
+        virtual bool RewindRaycast(const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, RewindRaycastHits& outHits) const = 0;
+
         //! Syncs all entities contained within a volume to the current rewind state.
         //! @param rewindVolume the volume to rewind entities within (needed for physics entities)
         virtual void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) = 0;
@@ -173,7 +173,7 @@ namespace Multiplayer
     void NetworkTransformComponentController::OnTransformChangedEvent(const AZ::Transform& localTm, const AZ::Transform& worldTm)
     {
         const AZ::Transform& localOrWorld = GetParentEntityId() == InvalidNetEntityId ? worldTm : localTm;
-        SetRotation(localOrWorld.GetRotation());
+        SetRotation(AzNetworking::QuantizedQuaternion(localOrWorld.GetRotation()));
         SetTranslation(localOrWorld.GetTranslation());
         SetScale(localOrWorld.GetUniformScale());
     }
@@ -50,9 +50,13 @@ namespace Multiplayer
         return m_entityReplicationManager;
     }
 
-    void ClientToServerConnectionData::Update()
+    void ClientToServerConnectionData::GenerateUpdates()
     {
-        m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates();
+        m_entityReplicationManager.GenerateUpdatePackets();
+    }
+
+    void ClientToServerConnectionData::SendUpdates()
+    {
+        m_entityReplicationManager.SendGeneratedUpdatePackets();
     }
 }
@@ -77,9 +77,9 @@ namespace Multiplayer
         return m_entityReplicationManager;
     }
 
-    void ServerToClientConnectionData::Update()
+    void ServerToClientConnectionData::GenerateUpdates()
     {
-        m_entityReplicationManager.ActivatePendingEntities();
+        m_readyToSendUpdates = false;
 
         if (CanSendUpdates())
         {
@@ -87,11 +87,21 @@ namespace Multiplayer
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
             if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
             {
-                m_entityReplicationManager.SendUpdates();
+                m_entityReplicationManager.GenerateUpdatePackets();
+                m_readyToSendUpdates = true;
             }
         }
     }
 
+    void ServerToClientConnectionData::SendUpdates()
+    {
+        if (m_readyToSendUpdates)
+        {
+            m_entityReplicationManager.SendGeneratedUpdatePackets();
+            m_readyToSendUpdates = false;
+        }
+    }
+
     void ServerToClientConnectionData::OnControlledEntityRemove()
     {
         m_connection->Disconnect(AzNetworking::DisconnectReason::TerminatedByServer, AzNetworking::TerminationEndpoint::Local);
@@ -31,7 +31,8 @@ namespace Multiplayer
         ConnectionDataType GetConnectionDataType() const override;
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
-        void Update() override;
+        void GenerateUpdates() override;
+        void SendUpdates() override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
         bool DidHandshake() const override;
@@ -56,6 +57,7 @@ namespace Multiplayer
         AzNetworking::IConnection* m_connection = nullptr;
         bool m_canSendUpdates = false;
         bool m_didHandshake = false;
+        bool m_readyToSendUpdates = false;
     };
 }
 
@@ -29,6 +29,9 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Session/ISessionRequests.h>
 #include <AzFramework/Session/SessionConfig.h>
@@ -389,12 +392,17 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
-            auto sendNetworkUpdates = [&stats](IConnection& connection)
+            AZStd::vector<IConnectionData*> connectionDataList;
+            connectionDataList.reserve(m_networkInterface->GetConnectionSet().GetConnectionCount());
+
+            auto gatherConnections = [&stats, &connectionDataList](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update();
+                    // Entity activation touches live entities and buses, so it must complete before the parallel fan-out
+                    connectionData->GetReplicationManager().ActivatePendingEntities();
+                    connectionDataList.push_back(connectionData);
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -406,7 +414,35 @@ namespace Multiplayer
                 }
             };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            m_networkInterface->GetConnectionSet().VisitConnections(gatherConnections);
+
+            // Update generation only reads entity state, so fan the per-connection serialization out across the job manager
+            AZ::JobContext* jobContext = nullptr;
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+            if (jobContext != nullptr && connectionDataList.size() > 1)
+            {
+                AZ::JobCompletion jobCompletion(jobContext);
+                for (IConnectionData* connectionData : connectionDataList)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([connectionData]() { connectionData->GenerateUpdates(); }, true, jobContext);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (IConnectionData* connectionData : connectionDataList)
+                {
+                    connectionData->GenerateUpdates();
+                }
+            }
+
+            // Packet transmission mutates connection and socket state, so sends stay on the tick thread
+            for (IConnectionData* connectionData : connectionDataList)
+            {
+                connectionData->SendUpdates();
+            }
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -26,7 +26,9 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 namespace Multiplayer
 {
@@ -34,8 +36,12 @@ namespace Multiplayer
     constexpr uint32_t UdpPacketHeaderSerializeSize = 12;
     // Take out a few extra bytes for special headers, we currently only use 1 byte for the count of entity updates
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
+    // Priority floor added each tick an update stays pending, guarantees forward progress for zero priority entities under budget pressure
+    constexpr float MinimumReplicationPriority = 0.001f;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(uint32_t, sv_ReplicationSendBudgetKbps, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "Per connection bandwidth budget for entity replication in kilobits per second, 0 disables budgeting");
+    AZ_CVAR(float, sv_ReplicationBudgetLossBackoff, 2.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "How aggressively the replication send budget shrinks as the connection reports packet loss");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -110,34 +116,52 @@ namespace Multiplayer
         }
     }
 
-    void EntityReplicationManager::SendUpdates()
+    void EntityReplicationManager::GenerateUpdatePackets()
     {
+        const AZ::TimeMs previousFrameTimeMs = m_frameTimeMs;
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
+        // Refresh the bandwidth budget for this send interval, backing off as the connection reports packet loss
+        m_sendBudgetBytes = 0;
+        m_sendBudgetBytesUsed = 0;
+        if ((sv_ReplicationSendBudgetKbps > 0) && (m_updateMode == Mode::LocalServerToRemoteClient))
         {
-            EntityReplicatorList toSendList = GenerateEntityUpdateList();
+            const AZ::TimeMs deltaTimeMs = AZ::GetMin(m_frameTimeMs - previousFrameTimeMs, AZ::TimeMs{ 1000 });
+            const float lossRatePercent = m_connection.GetMetrics().m_sendDatarate.GetLossRatePercent();
+            const float lossBackoff = AZ::GetClamp(1.0f - (lossRatePercent * sv_ReplicationBudgetLossBackoff * 0.01f), 0.1f, 1.0f);
+            const float budgetBytesPerMs = (static_cast<float>(sv_ReplicationSendBudgetKbps) * 1024.0f) / (8.0f * 1000.0f);
+            const uint32_t budgetBytes = aznumeric_cast<uint32_t>(budgetBytesPerMs * static_cast<float>(deltaTimeMs) * lossBackoff);
+            // Always allow at least one full packet so entity creation and high priority updates make progress
+            m_sendBudgetBytes = AZ::GetMax(budgetBytes, m_maxPayloadSize);
+        }
 
-            AZLOG
-            (
-                NET_ReplicationInfo,
-                "Sending %zd updates from %s to %s",
-                toSendList.size(),
-                GetNetworkEntityManager()->GetHostId().GetString().c_str(),
-                GetRemoteHostId().GetString().c_str()
-            );
+        EntityReplicatorList toSendList = GenerateEntityUpdateList();
 
-            // Prep a replication record for send, at this point, everything needs to be sent
-            for (EntityReplicator* replicator : toSendList)
-            {
-                replicator->GetPropertyPublisher()->PrepareSerialization();
-            }
+        AZLOG
+        (
+            NET_ReplicationInfo,
+            "Generating %zd updates from %s to %s",
+            toSendList.size(),
+            GetNetworkEntityManager()->GetHostId().GetString().c_str(),
+            GetRemoteHostId().GetString().c_str()
+        );
+
+        GenerateEntityUpdateMessages(toSendList);
+    }
+
+    void EntityReplicationManager::SendGeneratedUpdatePackets()
+    {
+        for (GeneratedUpdatePacket& generatedPacket : m_generatedUpdatePackets)
+        {
+            const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(generatedPacket.m_entityUpdates);
 
-            // While our to send list is not empty, build up another packet to send
-            do
+            // Update the sent things with the packet id
+            for (EntityReplicator* replicator : generatedPacket.m_updatedReplicators)
             {
-                SendEntityUpdateMessages(toSendList);
-            } while (!toSendList.empty());
+                replicator->FinalizeSerialization(sentId);
+            }
         }
+        m_generatedUpdatePackets.clear();
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
@@ -166,8 +190,9 @@ namespace Multiplayer
 
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
+        AZStd::vector<EntityReplicator*> proxyCandidates;
 
-        uint32_t proxySendCount = 0;
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -205,10 +230,14 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            // Accumulate window priority every tick the update stays pending, so entities
+                            // starved by the send budget rise to the front of a later update list
+                            const auto replicationEntry = replicationSet.find(replicator->GetEntityHandle());
+                            const float basePriority = (replicationEntry != replicationSet.end()) ? replicationEntry->second.m_priority : 0.0f;
+                            replicator->AccumulateSendPriority(basePriority + MinimumReplicationPriority);
+                            proxyCandidates.push_back(replicator);
                         }
                     }
                 }
@@ -225,34 +254,58 @@ namespace Multiplayer
             }
         }
 
+        // Schedule the highest accumulated priority proxies first, autonomous entities always lead the list
+        AZStd::sort(proxyCandidates.begin(), proxyCandidates.end(),
+            [](const EntityReplicator* lhs, const EntityReplicator* rhs)
+            {
+                return lhs->GetAccumulatedSendPriority() > rhs->GetAccumulatedSendPriority();
+            });
+
+        const uint32_t proxySendCount = AZ::GetMin(aznumeric_cast<uint32_t>(proxyCandidates.size()), m_replicationWindow->GetMaxProxyEntityReplicatorSendCount());
+        toSendList.insert(toSendList.end(), proxyCandidates.begin(), proxyCandidates.begin() + proxySendCount);
+
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::GenerateEntityUpdateMessages(EntityReplicatorList& replicatorList)
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        NetworkEntityUpdateVector entityUpdates;
+        GeneratedUpdatePacket* generatedPacket = &m_generatedUpdatePackets.emplace_back();
         // Serialize everything
         while (!replicatorList.empty())
         {
+            // Once the send budget is spent, leave the remaining replicators pending; they retain their
+            // accumulated priority and will lead the next update list instead of saturating the link
+            if ((m_sendBudgetBytes > 0) && (m_sendBudgetBytesUsed >= m_sendBudgetBytes))
+            {
+                replicatorList.clear();
+                break;
+            }
+
             EntityReplicator* replicator = replicatorList.front();
+
+            // Prep the replication record for send, deferred to this point so budget-dropped entities stay unprepared
+            replicator->GetPropertyPublisher()->PrepareSerialization();
             NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > m_maxPayloadSize);
-            const bool capacityReached = (entityUpdates.size() >= entityUpdates.capacity());
-            const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
+            const bool capacityReached = (generatedPacket->m_entityUpdates.size() >= generatedPacket->m_entityUpdates.capacity());
+            const bool largeEntityDetected = (payloadFull && generatedPacket->m_updatedReplicators.empty());
             if (capacityReached || (payloadFull && !largeEntityDetected))
             {
-                break;
+                // Close out the current packet and start filling the next one
+                generatedPacket = &m_generatedUpdatePackets.emplace_back();
+                pendingPacketSize = 0;
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdates.push_back(updateMessage);
-            replicatorUpdatedList.push_back(replicator);
+            m_sendBudgetBytesUsed += nextMessageSize;
+            generatedPacket->m_entityUpdates.push_back(updateMessage);
+            generatedPacket->m_updatedReplicators.push_back(replicator);
+            replicator->ClearAccumulatedSendPriority();
             replicatorList.pop_front();
 
             if (largeEntityDetected)
@@ -264,17 +317,13 @@ namespace Multiplayer
                     m_maxPayloadSize,
                     nextMessageSize
                 );
-                break;
+                if (!replicatorList.empty())
+                {
+                    generatedPacket = &m_generatedUpdatePackets.emplace_back();
+                    pendingPacketSize = 0;
+                }
             }
         }
-
-        const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
-
-        // Update the sent things with the packet id
-        for (EntityReplicator* replicator : replicatorUpdatedList)
-        {
-            replicator->FinalizeSerialization(sentId);
-        }
     }
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& rpcMessages, bool reliable)
@@ -335,6 +384,8 @@ namespace Multiplayer
             m_replicatorsPendingSend.clear();
         }
 
+        // Generated packets hold raw replicator pointers, drop them before destroying the replicators
+        m_generatedUpdatePackets.clear();
         m_entityReplicatorMap.clear();
     }
 
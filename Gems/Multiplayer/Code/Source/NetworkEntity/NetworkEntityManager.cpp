@@ -13,6 +13,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Slice/SliceMetadataInfoComponent.h>
+#include <AzCore/Time/ITime.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Entity/EntityContextBus.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
@@ -28,6 +29,7 @@
 namespace Multiplayer
 {
     AZ_CVAR(bool, net_DebugCheckNetworkEntityManager, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables extra debug checks inside the NetworkEntityManager");
+    AZ_CVAR(AZ::TimeMs, sv_SpatialMapRebuildIntervalMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum time between rebuilds of the networked entity spatial map, queries within the interval reuse the previous rebuild");
 
     NetworkEntityManager::NetworkEntityManager()
         : m_networkEntityAuthorityTracker(*this)
@@ -83,6 +85,12 @@ namespace Multiplayer
         return &m_networkEntityAuthorityTracker;
     }
 
+    NetworkEntitySpatialMap* NetworkEntityManager::GetNetworkEntitySpatialMap()
+    {
+        RebuildSpatialMapIfStale();
+        return &m_networkEntitySpatialMap;
+    }
+
     MultiplayerComponentRegistry* NetworkEntityManager::GetMultiplayerComponentRegistry()
     {
         return &m_multiplayerComponentRegistry;
@@ -332,6 +340,32 @@ namespace Multiplayer
         m_controllersActivatedEvent.DisconnectAllHandlers();
         m_controllersDeactivatedEvent.DisconnectAllHandlers();
         m_localDeferredRpcMessages.clear();
+        m_networkEntitySpatialMap.Clear();
+        m_spatialMapBuilt = false;
+    }
+
+    void NetworkEntityManager::RebuildSpatialMapIfStale()
+    {
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (m_spatialMapBuilt && ((currentTimeMs - m_spatialMapRebuildTimeMs) < sv_SpatialMapRebuildIntervalMs))
+        {
+            return;
+        }
+
+        m_networkEntitySpatialMap.Clear();
+        for (auto& entityPair : m_networkEntityTracker)
+        {
+            AZ::Entity* entity = entityPair.second;
+            AZ::TransformInterface* transformInterface = (entity != nullptr) ? entity->GetTransform() : nullptr;
+            if (transformInterface == nullptr)
+            {
+                // The entity has not activated yet, so it has no world position to bucket by
+                continue;
+            }
+            m_networkEntitySpatialMap.Insert(ConstNetworkEntityHandle(entity, &m_networkEntityTracker), transformInterface->GetWorldTranslation());
+        }
+        m_spatialMapBuilt = true;
+        m_spatialMapRebuildTimeMs = currentTimeMs;
     }
 
     void NetworkEntityManager::RemoveEntities()
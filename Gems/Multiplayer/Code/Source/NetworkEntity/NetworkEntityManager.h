@@ -12,6 +12,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzFramework/Spawnable/RootSpawnableInterface.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
+#include <Source/NetworkEntity/NetworkEntitySpatialMap.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/NetworkEntity/NetworkSpawnableLibrary.h>
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
@@ -38,6 +39,7 @@ namespace Multiplayer
         IEntityDomain* GetEntityDomain() const override;
         NetworkEntityTracker* GetNetworkEntityTracker() override;
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override;
+        NetworkEntitySpatialMap* GetNetworkEntitySpatialMap() override;
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override;
         const HostId& GetHostId() const override;
         ConstNetworkEntityHandle GetEntity(NetEntityId netEntityId) const override;
@@ -98,11 +100,15 @@ namespace Multiplayer
 
     private:
         void RemoveEntities();
+        void RebuildSpatialMapIfStale();
         NetEntityId NextId();
         bool IsHierarchySafeToExit(NetworkEntityHandle& entityHandle, const NetEntityIdSet& entitiesNotInDomain);
 
         NetworkEntityTracker m_networkEntityTracker;
         NetworkEntityAuthorityTracker m_networkEntityAuthorityTracker;
+        NetworkEntitySpatialMap m_networkEntitySpatialMap;
+        AZ::TimeMs m_spatialMapRebuildTimeMs = AZ::Time::ZeroTimeMs;
+        bool m_spatialMapBuilt = false;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
 
         AZ::ScheduledEvent m_removeEntitiesEvent;
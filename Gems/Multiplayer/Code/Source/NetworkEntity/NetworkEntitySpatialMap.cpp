@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/NetworkEntitySpatialMap.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_SpatialMapCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The world size in meters of a single cell of the networked entity spatial map, applied on the next rebuild");
+
+    void NetworkEntitySpatialMap::Clear()
+    {
+        // Clear the cells in place so their capacity survives the rebuild
+        for (auto& cellPair : m_cells)
+        {
+            cellPair.second.clear();
+        }
+        m_entityCount = 0;
+        m_cellSize = AZ::GetMax(static_cast<float>(sv_SpatialMapCellSize), 1.0f);
+    }
+
+    void NetworkEntitySpatialMap::Insert(const ConstNetworkEntityHandle& entityHandle, const AZ::Vector3& position)
+    {
+        const uint64_t cellKey = GetCellKey(position.GetX(), position.GetY());
+        m_cells[cellKey].push_back(CellEntry{ entityHandle, position });
+        m_entityCount++;
+    }
+
+    void NetworkEntitySpatialMap::GatherEntitiesWithinRadius(const AZ::Vector3& position, float radius, GatherResults& outResults) const
+    {
+        const float radiusSquared = radius * radius;
+        const int32_t minCellX = aznumeric_cast<int32_t>(floorf((position.GetX() - radius) / m_cellSize));
+        const int32_t maxCellX = aznumeric_cast<int32_t>(floorf((position.GetX() + radius) / m_cellSize));
+        const int32_t minCellY = aznumeric_cast<int32_t>(floorf((position.GetY() - radius) / m_cellSize));
+        const int32_t maxCellY = aznumeric_cast<int32_t>(floorf((position.GetY() + radius) / m_cellSize));
+
+        for (int32_t cellY = minCellY; cellY <= maxCellY; ++cellY)
+        {
+            for (int32_t cellX = minCellX; cellX <= maxCellX; ++cellX)
+            {
+                const auto cellIter = m_cells.find(MakeCellKey(cellX, cellY));
+                if (cellIter == m_cells.end())
+                {
+                    continue;
+                }
+
+                for (const CellEntry& cellEntry : cellIter->second)
+                {
+                    const float distanceSquared = position.GetDistanceSq(cellEntry.m_position);
+                    if (distanceSquared <= radiusSquared)
+                    {
+                        outResults.push_back(GatherResult{ cellEntry.m_entityHandle, distanceSquared });
+                    }
+                }
+            }
+        }
+    }
+
+    uint32_t NetworkEntitySpatialMap::GetEntityCount() const
+    {
+        return m_entityCount;
+    }
+
+    uint64_t NetworkEntitySpatialMap::GetCellKey(float x, float y) const
+    {
+        const int32_t cellX = aznumeric_cast<int32_t>(floorf(x / m_cellSize));
+        const int32_t cellY = aznumeric_cast<int32_t>(floorf(y / m_cellSize));
+        return MakeCellKey(cellX, cellY);
+    }
+
+    uint64_t NetworkEntitySpatialMap::MakeCellKey(int32_t cellX, int32_t cellY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(cellY));
+    }
+}
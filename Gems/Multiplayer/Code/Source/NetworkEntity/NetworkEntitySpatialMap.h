@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class NetworkEntitySpatialMap
+    //! @brief A coarse spatial hash over all networked entities, shared by every server replication window.
+    //!
+    //! Replication windows periodically gather the entities near their client to rebuild their replication sets.
+    //! The visibility octree contains every visible entity whether networked or not, so each window pays to walk
+    //! and filter a far larger population than it can replicate. This map buckets only the networked entities
+    //! into xy grid cells and is rebuilt by the NetworkEntityManager at most once per rebuild interval, so the
+    //! per-window gather reduces to a walk of the cells overlapping the client awareness radius.
+    class NetworkEntitySpatialMap
+    {
+    public:
+
+        //! A single entity returned by a gather, along with its squared distance from the gather position.
+        struct GatherResult
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            float m_distanceSquared = 0.0f;
+        };
+        using GatherResults = AZStd::vector<GatherResult>;
+
+        //! Removes all entities from the map and latches the current cell size console variable.
+        void Clear();
+
+        //! Inserts an entity into the map at the given world position.
+        //! @param entityHandle handle to the entity to insert
+        //! @param position     the world position of the entity
+        void Insert(const ConstNetworkEntityHandle& entityHandle, const AZ::Vector3& position);
+
+        //! Gathers all entities within the given radius of a world position.
+        //! Entity positions are as of the last rebuild, so callers should revalidate the returned handles.
+        //! @param position   the centre of the gather sphere
+        //! @param radius     the gather radius in meters
+        //! @param outResults filled with the gathered entities and their squared distances from position
+        void GatherEntitiesWithinRadius(const AZ::Vector3& position, float radius, GatherResults& outResults) const;
+
+        //! Returns the total number of entities in the map.
+        //! @return the total number of entities in the map
+        uint32_t GetEntityCount() const;
+
+    private:
+
+        //! Converts a world space xy coordinate pair into a cell key.
+        uint64_t GetCellKey(float x, float y) const;
+
+        //! Packs a pair of integer cell coordinates into a cell key.
+        static uint64_t MakeCellKey(int32_t cellX, int32_t cellY);
+
+        struct CellEntry
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Vector3 m_position;
+        };
+        using Cell = AZStd::vector<CellEntry>;
+
+        AZStd::unordered_map<uint64_t, Cell> m_cells;
+        float m_cellSize = 64.0f;
+        uint32_t m_entityCount = 0;
+    };
+}
@@ -9,6 +9,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/TrackChangedSerializer.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace Multiplayer
@@ -194,6 +195,24 @@ namespace Multiplayer
     }
 
     bool NetworkEntityUpdateMessage::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        // Dispatch once per message to the concrete serializer type so the per-field calls
+        // below bind statically against the wire serializers instead of the virtual interface
+        switch (serializer.GetSerializerType())
+        {
+        case AzNetworking::SerializerType::NetworkInput:
+            return SerializeDetail(static_cast<AzNetworking::NetworkInputSerializer&>(serializer));
+        case AzNetworking::SerializerType::NetworkOutput:
+            return SerializeDetail(static_cast<AzNetworking::NetworkOutputSerializer&>(serializer));
+        case AzNetworking::SerializerType::TrackChangedNetworkOutput:
+            return SerializeDetail(static_cast<AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer>&>(serializer));
+        default:
+            return SerializeDetail(serializer);
+        }
+    }
+
+    template <typename Serializer>
+    bool NetworkEntityUpdateMessage::SerializeDetail(Serializer& serializer)
     {
         // Always serialize the entityId
         serializer.Serialize(m_entityId, "EntityId");
@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkTime/NetworkTime.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
@@ -19,6 +20,7 @@ namespace Multiplayer
 {
     AZ_CVAR(float, sv_RewindVolumeExtrudeDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount to increase rewind volume checks to account for fast moving entities");
     AZ_CVAR(bool, bg_RewindDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true enables debug draw of rewind operations");
+    AZ_CVAR(bool, sv_RewindHistoryCapture, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true the host snapshots entity transforms each frame so rewind queries resolve against history instead of live entities");
 
     NetworkTime::NetworkTime()
     {
@@ -50,6 +52,11 @@ namespace Multiplayer
         AZ_Assert(!IsTimeRewound(), "Incrementing the global application frameId is unsupported under a rewound time scope");
         ++m_unalteredFrameId;
         m_hostFrameId = m_unalteredFrameId;
+
+        if (sv_RewindHistoryCapture)
+        {
+            m_rewindHistory.CaptureSnapshot(m_hostFrameId);
+        }
     }
 
     AZ::TimeMs NetworkTime::GetHostTimeMs() const
@@ -84,6 +91,11 @@ namespace Multiplayer
         m_rewindingConnectionId = rewindConnectionId;
     }
 
+    bool NetworkTime::RewindRaycast(const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, RewindRaycastHits& outHits) const
+    {
+        return m_rewindHistory.Raycast(m_hostFrameId, m_hostBlendFactor, start, direction, maxDistance, outHits);
+    }
+
     void NetworkTime::SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume)
     {
         if (!IsTimeRewound())
@@ -93,9 +105,6 @@ namespace Multiplayer
             return;
         }
 
-        // Since the vis system doesn't support rewound queries, first query with an expanded volume to catch any fast moving entities
-        const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
-
         AzFramework::DebugDisplayRequests* debugDisplay = nullptr;
         if (bg_RewindDebugDraw)
         {
@@ -104,6 +113,38 @@ namespace Multiplayer
             debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
         }
 
+        if (m_rewindHistory.HasFrame(m_hostFrameId))
+        {
+            // The history store holds entity positions for the target frame directly, so no volume
+            // extrusion or per-entity component reads are needed to find the overlapping entities
+            if (debugDisplay)
+            {
+                debugDisplay->SetColor(AZ::Colors::Red);
+                debugDisplay->DrawWireBox(rewindVolume.GetMin(), rewindVolume.GetMax());
+            }
+
+            NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+            m_rewindHistory.EnumerateRewoundVolume(m_hostFrameId, m_hostBlendFactor, rewindVolume,
+                [this, networkEntityTracker, debugDisplay](NetEntityId netEntityId, const AZ::Aabb& rewoundBounds)
+                {
+                    if (debugDisplay)
+                    {
+                        debugDisplay->SetColor(AZ::Colors::Grey);
+                        debugDisplay->DrawWireBox(rewoundBounds.GetMin(), rewoundBounds.GetMax());
+                    }
+
+                    NetworkEntityHandle entityHandle = networkEntityTracker->Get(netEntityId);
+                    if (entityHandle.GetNetBindComponent() != nullptr)
+                    {
+                        m_rewoundEntities.push_back(entityHandle);
+                    }
+                });
+            return;
+        }
+
+        // Since the vis system doesn't support rewound queries, first query with an expanded volume to catch any fast moving entities
+        const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
+
         if (debugDisplay)
         {
             debugDisplay->SetColor(AZ::Colors::Red);
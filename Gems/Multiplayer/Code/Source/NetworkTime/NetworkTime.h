@@ -10,6 +10,7 @@
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Source/NetworkTime/RewindHistory.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
 
@@ -34,12 +35,14 @@ namespace Multiplayer
         AzNetworking::ConnectionId GetRewindingConnectionId() const override;
         void ForceSetTime(HostFrameId frameId, AZ::TimeMs timeMs) override;
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) override;
+        bool RewindRaycast(const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, RewindRaycastHits& outHits) const override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
         void ClearRewoundEntities() override;
         //! @}
 
     private:
 
+        RewindHistory m_rewindHistory;
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/RewindHistory.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+
+namespace Multiplayer
+{
+    void RewindHistory::CaptureSnapshot(HostFrameId frameId)
+    {
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if ((networkEntityTracker == nullptr) || (entityBoundsUnion == nullptr))
+        {
+            return;
+        }
+
+        SnapshotFrame& frame = m_frames[static_cast<uint32_t>(frameId) % RewindHistoryFrameCount];
+        frame.m_frameId = frameId;
+        frame.m_entityIds.clear();
+        frame.m_positions.clear();
+        frame.m_orientations.clear();
+        frame.m_bounds.clear();
+        frame.m_entityIndexMap.clear();
+
+        const AZStd::size_t entityCount = networkEntityTracker->size();
+        frame.m_entityIds.reserve(entityCount);
+        frame.m_positions.reserve(entityCount);
+        frame.m_orientations.reserve(entityCount);
+        frame.m_bounds.reserve(entityCount);
+        frame.m_entityIndexMap.reserve(entityCount);
+
+        for (auto& [netEntityId, entity] : *networkEntityTracker)
+        {
+            AZ::TransformInterface* transformInterface = (entity != nullptr) ? entity->GetTransform() : nullptr;
+            if (transformInterface == nullptr)
+            {
+                continue;
+            }
+
+            const AZ::Aabb bounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
+            if (!bounds.IsValid())
+            {
+                continue;
+            }
+
+            const uint32_t index = aznumeric_cast<uint32_t>(frame.m_entityIds.size());
+            frame.m_entityIds.push_back(netEntityId);
+            frame.m_positions.push_back(transformInterface->GetWorldTranslation());
+            frame.m_orientations.push_back(transformInterface->GetWorldRotationQuaternion());
+            frame.m_bounds.push_back(bounds);
+            frame.m_entityIndexMap.emplace(netEntityId, index);
+        }
+    }
+
+    bool RewindHistory::HasFrame(HostFrameId frameId) const
+    {
+        return GetFrame(frameId) != nullptr;
+    }
+
+    void RewindHistory::EnumerateRewoundVolume(HostFrameId frameId, float blendFactor, const AZ::Aabb& volume, const EnumerationCallback& callback) const
+    {
+        const SnapshotFrame* frame = GetFrame(frameId);
+        if (frame == nullptr)
+        {
+            return;
+        }
+        const SnapshotFrame* previousFrame = GetFrame(frameId - HostFrameId{ 1 });
+
+        const uint32_t entityCount = aznumeric_cast<uint32_t>(frame->m_entityIds.size());
+        for (uint32_t index = 0; index < entityCount; ++index)
+        {
+            const AZ::Aabb rewoundBounds = GetRewoundBounds(*frame, previousFrame, index, blendFactor);
+            if (AZ::ShapeIntersection::Overlaps(rewoundBounds, volume))
+            {
+                callback(frame->m_entityIds[index], rewoundBounds);
+            }
+        }
+    }
+
+    bool RewindHistory::Raycast(HostFrameId frameId, float blendFactor, const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, RewindRaycastHits& outHits) const
+    {
+        const SnapshotFrame* frame = GetFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+        const SnapshotFrame* previousFrame = GetFrame(frameId - HostFrameId{ 1 });
+
+        const AZ::Vector3 directionReciprocal = direction.GetReciprocal();
+        const uint32_t entityCount = aznumeric_cast<uint32_t>(frame->m_entityIds.size());
+        for (uint32_t index = 0; index < entityCount; ++index)
+        {
+            const AZ::Aabb rewoundBounds = GetRewoundBounds(*frame, previousFrame, index, blendFactor);
+            float hitStart = 0.0f;
+            float hitEnd = 0.0f;
+            if (AZ::Intersect::IntersectRayAABB2(start, directionReciprocal, rewoundBounds, hitStart, hitEnd) != AZ::Intersect::ISECT_RAY_AABB_NONE)
+            {
+                if ((hitEnd >= 0.0f) && (hitStart <= maxDistance))
+                {
+                    outHits.push_back({ frame->m_entityIds[index], AZ::GetMax(hitStart, 0.0f) });
+                }
+            }
+        }
+
+        AZStd::sort(outHits.begin(), outHits.end(),
+            [](const RewindRaycastHit& lhs, const RewindRaycastHit& rhs)
+            {
+                return lhs.m_hitDistance < rhs.m_hitDistance;
+            });
+
+        return !outHits.empty();
+    }
+
+    void RewindHistory::Clear()
+    {
+        for (SnapshotFrame& frame : m_frames)
+        {
+            frame.m_frameId = InvalidHostFrameId;
+            frame.m_entityIds.clear();
+            frame.m_positions.clear();
+            frame.m_orientations.clear();
+            frame.m_bounds.clear();
+            frame.m_entityIndexMap.clear();
+        }
+    }
+
+    const RewindHistory::SnapshotFrame* RewindHistory::GetFrame(HostFrameId frameId) const
+    {
+        if (frameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+        const SnapshotFrame& frame = m_frames[static_cast<uint32_t>(frameId) % RewindHistoryFrameCount];
+        return (frame.m_frameId == frameId) ? &frame : nullptr;
+    }
+
+    AZ::Aabb RewindHistory::GetRewoundBounds(const SnapshotFrame& frame, const SnapshotFrame* previousFrame, uint32_t index, float blendFactor) const
+    {
+        const AZ::Vector3& framePosition = frame.m_positions[index];
+        AZ::Vector3 rewoundPosition = framePosition;
+        if ((previousFrame != nullptr) && !AZ::IsClose(blendFactor, 1.0f))
+        {
+            const auto previousEntry = previousFrame->m_entityIndexMap.find(frame.m_entityIds[index]);
+            if (previousEntry != previousFrame->m_entityIndexMap.end())
+            {
+                rewoundPosition = previousFrame->m_positions[previousEntry->second].Lerp(framePosition, blendFactor);
+            }
+        }
+        return frame.m_bounds[index].GetTranslated(rewoundPosition - framePosition);
+    }
+}
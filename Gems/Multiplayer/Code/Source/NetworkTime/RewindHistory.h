@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace Multiplayer
+{
+    //! @class RewindHistory
+    //! @brief A fixed ring of per-frame entity transform snapshots used to resolve rewind queries.
+    //!
+    //! Lag compensation queries previously touched every candidate entity's components to recover its
+    //! rewound position, scattering reads across component memory for each shot validated. This store
+    //! snapshots (entityId, position, orientation, bounds) for all tracked entities into contiguous
+    //! per-frame arrays once per host frame, so rewind volume tests and raycasts walk dense arrays and
+    //! never need to reposition live entities.
+    class RewindHistory
+    {
+    public:
+
+        //! Number of snapshot frames retained, covering roughly one second at typical server tick rates.
+        static constexpr uint32_t RewindHistoryFrameCount = 64;
+
+        using EnumerationCallback = AZStd::function<void(NetEntityId, const AZ::Aabb& rewoundBounds)>;
+
+        //! Snapshots the current position, orientation and bounds of every tracked entity for the given frame.
+        //! @param frameId the host frame the snapshot corresponds to
+        void CaptureSnapshot(HostFrameId frameId);
+
+        //! Returns true if the store retains a snapshot for the given frame.
+        //! @param frameId the host frame to look up
+        //! @return true if a snapshot for the frame is available
+        bool HasFrame(HostFrameId frameId) const;
+
+        //! Invokes the callback for every snapshotted entity whose rewound bounds overlap the given volume.
+        //! @param frameId     the host frame to resolve entity state at
+        //! @param blendFactor the factor used to blend between the requested frame and the one preceding it
+        //! @param volume      the world space volume to test rewound entity bounds against
+        //! @param callback    invoked with the entity id and rewound bounds of each overlapping entity
+        void EnumerateRewoundVolume(HostFrameId frameId, float blendFactor, const AZ::Aabb& volume, const EnumerationCallback& callback) const;
+
+        //! Casts a ray against the rewound bounds of all snapshotted entities.
+        //! @param frameId     the host frame to resolve entity state at
+        //! @param blendFactor the factor used to blend between the requested frame and the one preceding it
+        //! @param start       the world space start point of the ray
+        //! @param direction   the normalized direction of the ray
+        //! @param maxDistance the maximum hit distance to consider
+        //! @param outHits     filled with all hit entities, sorted nearest first
+        //! @return true if at least one entity was hit
+        bool Raycast(HostFrameId frameId, float blendFactor, const AZ::Vector3& start, const AZ::Vector3& direction, float maxDistance, RewindRaycastHits& outHits) const;
+
+        //! Drops all retained snapshots.
+        void Clear();
+
+    private:
+
+        //! A single frame of entity state, stored as parallel arrays indexed together.
+        struct SnapshotFrame
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AZStd::vector<NetEntityId> m_entityIds;
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Quaternion> m_orientations;
+            AZStd::vector<AZ::Aabb> m_bounds;
+            AZStd::unordered_map<NetEntityId, uint32_t> m_entityIndexMap; // For cross-frame lookups when blending
+        };
+
+        const SnapshotFrame* GetFrame(HostFrameId frameId) const;
+
+        //! Computes the rewound bounds of the entity at the given index, blending against the previous frame when present.
+        AZ::Aabb GetRewoundBounds(const SnapshotFrame& frame, const SnapshotFrame* previousFrame, uint32_t index, float blendFactor) const;
+
+        AZStd::array<SnapshotFrame, RewindHistoryFrameCount> m_frames;
+    };
+}
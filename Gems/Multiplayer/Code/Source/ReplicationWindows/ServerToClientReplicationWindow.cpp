@@ -8,9 +8,9 @@
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Source/NetworkEntity/NetworkEntitySpatialMap.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
-#include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/sort.h>
@@ -121,46 +121,32 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-            {
-                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                {
-                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                    {
-                        gatheredEntries.push_back(visEntry);
-                    }
-                }
-            }
-        );
+        // Gather the networked entities near the client from the shared spatial map, which only contains
+        // networked entities, rather than walking the visibility octree and filtering out everything else
+        NetworkEntitySpatialMap* spatialMap = AZ::Interface<INetworkEntityManager>::Get()->GetNetworkEntitySpatialMap();
+        NetworkEntitySpatialMap::GatherResults gatheredEntities;
+        spatialMap->GatherEntitiesWithinRadius(controlledEntityPosition, sv_ClientAwarenessRadius, gatheredEntities);
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
         IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
 
         // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        for (const NetworkEntitySpatialMap::GatherResult& gatherResult : gatheredEntities)
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
+            ConstNetworkEntityHandle entityHandle = gatherResult.m_entityHandle;
             if (entityHandle.GetNetBindComponent() == nullptr)
             {
-                // Entity does not have netbinding, skip this entity
+                // The entity has been removed since the spatial map was last rebuilt, skip this entity
                 continue;
             }
 
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entityHandle.GetEntity(), m_controlledEntity, m_connection->GetConnectionId()))
             {
                 continue;
             }
 
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
+            const float gatherDistanceSquared = gatherResult.m_distanceSquared;
             const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
+
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
 
@@ -21,6 +21,7 @@
 #include <Multiplayer/Components/NetworkHierarchyChildComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <NetworkEntity/NetworkEntitySpatialMap.h>
 
 namespace Multiplayer
 {
@@ -134,6 +135,15 @@ namespace Multiplayer
         {
         }
 
+        bool RewindRaycast(
+            [[maybe_unused]] const AZ::Vector3& start,
+            [[maybe_unused]] const AZ::Vector3& direction,
+            [[maybe_unused]] float maxDistance,
+            [[maybe_unused]] Multiplayer::RewindRaycastHits& outHits) const override
+        {
+            return false;
+        }
+
         void SyncEntitiesToRewindState([[maybe_unused]] const AZ::Aabb& rewindVolume) override
         {
         }
@@ -205,6 +215,7 @@ namespace Multiplayer
 
         NetworkEntityTracker* GetNetworkEntityTracker() override { return &m_tracker; }
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override { return &m_authorityTracker; }
+        NetworkEntitySpatialMap* GetNetworkEntitySpatialMap() override { return &m_spatialMap; }
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override { return &m_multiplayerComponentRegistry; }
         const HostId& GetHostId() const override { return m_hostId; }
 
@@ -285,6 +296,7 @@ namespace Multiplayer
 
         NetworkEntityTracker m_tracker;
         NetworkEntityAuthorityTracker m_authorityTracker;
+        NetworkEntitySpatialMap m_spatialMap;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
         HostId m_hostId;
     };
@@ -56,6 +56,7 @@ namespace UnitTest
         MOCK_CONST_METHOD0(GetEntityDomain, Multiplayer::IEntityDomain*());
         MOCK_METHOD0(GetNetworkEntityTracker, Multiplayer::NetworkEntityTracker* ());
         MOCK_METHOD0(GetNetworkEntityAuthorityTracker, Multiplayer::NetworkEntityAuthorityTracker* ());
+        MOCK_METHOD0(GetNetworkEntitySpatialMap, Multiplayer::NetworkEntitySpatialMap* ());
         MOCK_METHOD0(GetMultiplayerComponentRegistry, Multiplayer::MultiplayerComponentRegistry* ());
         MOCK_CONST_METHOD0(GetHostId, const Multiplayer::HostId&());
         MOCK_CONST_METHOD1(GetEntity, Multiplayer::ConstNetworkEntityHandle(Multiplayer::NetEntityId));
@@ -117,6 +118,7 @@ namespace UnitTest
         MOCK_CONST_METHOD0(GetRewindingConnectionId, AzNetworking::ConnectionId());
         MOCK_CONST_METHOD1(GetHostFrameIdForRewindingConnection, Multiplayer::HostFrameId(AzNetworking::ConnectionId));
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
+        MOCK_CONST_METHOD4(RewindRaycast, bool(const AZ::Vector3&, const AZ::Vector3&, float, Multiplayer::RewindRaycastHits&));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
         MOCK_METHOD0(ClearRewoundEntities, void());
     };
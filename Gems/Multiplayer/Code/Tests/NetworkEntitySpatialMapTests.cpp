@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/NetworkEntitySpatialMap.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class NetworkEntitySpatialMapTests
+        : public AllocatorsFixture
+    {
+    public:
+        AZStd::unique_ptr<AZ::Entity> CreateTrackedEntity(Multiplayer::NetEntityId netEntityId)
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>();
+            Multiplayer::NetBindComponent* netBindComponent = entity->CreateComponent<Multiplayer::NetBindComponent>();
+            m_tracker.Add(netEntityId, entity.get());
+            m_tracker.RegisterNetBindComponent(entity.get(), netBindComponent);
+            return entity;
+        }
+
+        Multiplayer::NetworkEntityTracker m_tracker;
+    };
+
+    TEST_F(NetworkEntitySpatialMapTests, GatherEntitiesWithinRadius_ReturnsOnlyEntitiesInRange)
+    {
+        AZStd::unique_ptr<AZ::Entity> nearEntity = CreateTrackedEntity(Multiplayer::NetEntityId{ 1 });
+        AZStd::unique_ptr<AZ::Entity> diagonalEntity = CreateTrackedEntity(Multiplayer::NetEntityId{ 2 });
+        AZStd::unique_ptr<AZ::Entity> farEntity = CreateTrackedEntity(Multiplayer::NetEntityId{ 3 });
+        AZStd::unique_ptr<AZ::Entity> overheadEntity = CreateTrackedEntity(Multiplayer::NetEntityId{ 4 });
+
+        Multiplayer::NetworkEntitySpatialMap spatialMap;
+        spatialMap.Clear();
+        spatialMap.Insert(Multiplayer::ConstNetworkEntityHandle(nearEntity.get(), &m_tracker), AZ::Vector3(10.0f, 0.0f, 0.0f));
+        spatialMap.Insert(Multiplayer::ConstNetworkEntityHandle(diagonalEntity.get(), &m_tracker), AZ::Vector3(50.0f, 50.0f, 0.0f));
+        spatialMap.Insert(Multiplayer::ConstNetworkEntityHandle(farEntity.get(), &m_tracker), AZ::Vector3(200.0f, 0.0f, 0.0f));
+        // Overhead entity falls into an xy cell inside the gather range, but is outside the gather sphere
+        spatialMap.Insert(Multiplayer::ConstNetworkEntityHandle(overheadEntity.get(), &m_tracker), AZ::Vector3(0.0f, 0.0f, 150.0f));
+        EXPECT_EQ(spatialMap.GetEntityCount(), 4u);
+
+        Multiplayer::NetworkEntitySpatialMap::GatherResults gatherResults;
+        spatialMap.GatherEntitiesWithinRadius(AZ::Vector3::CreateZero(), 100.0f, gatherResults);
+
+        ASSERT_EQ(gatherResults.size(), 2);
+        for (const Multiplayer::NetworkEntitySpatialMap::GatherResult& gatherResult : gatherResults)
+        {
+            const bool isNear = (gatherResult.m_entityHandle == nearEntity.get());
+            const bool isDiagonal = (gatherResult.m_entityHandle == diagonalEntity.get());
+            EXPECT_TRUE(isNear || isDiagonal);
+            EXPECT_FLOAT_EQ(gatherResult.m_distanceSquared, isNear ? 100.0f : 5000.0f);
+        }
+    }
+
+    TEST_F(NetworkEntitySpatialMapTests, Clear_RemovesAllEntities)
+    {
+        AZStd::unique_ptr<AZ::Entity> entity = CreateTrackedEntity(Multiplayer::NetEntityId{ 1 });
+
+        Multiplayer::NetworkEntitySpatialMap spatialMap;
+        spatialMap.Insert(Multiplayer::ConstNetworkEntityHandle(entity.get(), &m_tracker), AZ::Vector3::CreateZero());
+        EXPECT_EQ(spatialMap.GetEntityCount(), 1u);
+
+        spatialMap.Clear();
+        EXPECT_EQ(spatialMap.GetEntityCount(), 0u);
+
+        Multiplayer::NetworkEntitySpatialMap::GatherResults gatherResults;
+        spatialMap.GatherEntitiesWithinRadius(AZ::Vector3::CreateZero(), 100.0f, gatherResults);
+        EXPECT_TRUE(gatherResults.empty());
+    }
+}
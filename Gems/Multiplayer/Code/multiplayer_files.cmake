@@ -113,6 +113,8 @@ set(FILES
     Source/NetworkEntity/NetworkEntityManager.cpp
     Source/NetworkEntity/NetworkEntityManager.h
     Source/NetworkEntity/NetworkEntityRpcMessage.cpp
+    Source/NetworkEntity/NetworkEntitySpatialMap.cpp
+    Source/NetworkEntity/NetworkEntitySpatialMap.h
     Source/NetworkEntity/NetworkEntityTracker.cpp
     Source/NetworkEntity/NetworkEntityTracker.h
     Source/NetworkEntity/NetworkEntityTracker.inl
@@ -126,6 +128,8 @@ set(FILES
     Source/NetworkInput/NetworkInputMigrationVector.cpp
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/NetworkTime/RewindHistory.cpp
+    Source/NetworkTime/RewindHistory.h
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
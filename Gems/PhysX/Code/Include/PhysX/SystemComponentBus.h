@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/functional.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 
@@ -34,6 +35,11 @@ namespace physx
 
 namespace PhysX
 {
+    /// Callback for asynchronous mesh cooking requests.
+    /// @param cookingSucceeded Whether the mesh was cooked successfully.
+    /// @param cookedData The cooked mesh data. Empty if cooking failed.
+    using MeshCookedCallback = AZStd::function<void(bool cookingSucceeded, const AZStd::vector<AZ::u8>& cookedData)>;
+
     /// Requests for the PhysX system component.
     /// The system component owns fundamental PhysX objects which manage worlds, rigid bodies, shapes, materials,
     /// constraints etc., and perform cooking (processing assets such as meshes and heightfields ready for use in PhysX).
@@ -65,6 +71,25 @@ namespace PhysX
         /// @return Pointer to the created mesh.
         virtual physx::PxTriangleMesh* CreateTriangleMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize) = 0;
 
+        /// Cooks a convex mesh on a worker job, caching the cooked data by a hash of the source geometry.
+        /// The vertex data is copied, so it does not need to outlive the call.
+        /// @param vertices Pointer to beginning of vertex data.
+        /// @param vertexCount Number of vertices in mesh.
+        /// @param callback Invoked with the cooked data when cooking completes. May be invoked from a
+        /// worker thread, or before this call returns if the geometry is already cached.
+        virtual void CookConvexMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount, MeshCookedCallback callback) = 0;
+
+        /// Cooks a triangle mesh on a worker job, caching the cooked data by a hash of the source geometry.
+        /// The vertex and index data are copied, so they do not need to outlive the call.
+        /// @param vertices Pointer to beginning of vertex data.
+        /// @param vertexCount Number of vertices in mesh.
+        /// @param indices Pointer to beginning of index data.
+        /// @param indexCount Number of indices in mesh.
+        /// @param callback Invoked with the cooked data when cooking completes. May be invoked from a
+        /// worker thread, or before this call returns if the geometry is already cached.
+        virtual void CookTriangleMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, MeshCookedCallback callback) = 0;
+
         /// Creates a new heightfield.
         /// @param samples Pointer to beginning of heightfield sample data.
         /// @param numRows Number of rows in the heightfield.
@@ -68,6 +68,7 @@ namespace UnitTest
         MOCK_CONST_METHOD0(GetHeights, AZStd::vector<float>());
         MOCK_CONST_METHOD1(UpdateHeights, AZStd::vector<float>(const AZ::Aabb& dirtyRegion));
         MOCK_CONST_METHOD1(UpdateHeightsAndMaterials, AZStd::vector<Physics::HeightMaterialPoint>(const AZ::Aabb& dirtyRegion));
+        MOCK_CONST_METHOD5(GetHeightfieldIndicesFromRegion, void(const AZ::Aabb&, size_t&, size_t&, size_t&, size_t&));
         MOCK_CONST_METHOD0(GetHeightfieldAabb, AZ::Aabb());
         MOCK_CONST_METHOD0(GetHeightfieldMinHeight, float());
         MOCK_CONST_METHOD0(GetHeightfieldMaxHeight, float());
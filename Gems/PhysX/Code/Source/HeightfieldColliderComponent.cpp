@@ -8,6 +8,7 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/Collision/CollisionGroups.h>
 #include <AzFramework/Physics/Collision/CollisionLayers.h>
@@ -17,6 +18,7 @@
 
 #include <Source/HeightfieldColliderComponent.h>
 #include <Source/RigidBodyStatic.h>
+#include <Source/Shape.h>
 #include <Source/SystemComponent.h>
 #include <Source/Utils.h>
 
@@ -86,9 +88,106 @@ namespace PhysX
         ClearHeightfield();
     }
 
-    void HeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void HeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
-        RefreshHeightfield();
+        // An invalid dirty region means the heightfield structure itself may have changed, which requires a full
+        // rebuild. Otherwise try to modify only the samples within the dirty region, and fall back to the full
+        // rebuild if that isn't possible.
+        if (!dirtyRegion.IsValid() || !UpdateHeightfieldSamples(dirtyRegion))
+        {
+            RefreshHeightfield();
+        }
+    }
+
+    bool HeightfieldColliderComponent::UpdateHeightfieldSamples(const AZ::Aabb& dirtyRegion)
+    {
+        Physics::HeightfieldShapeConfiguration& configuration =
+            static_cast<Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+
+        auto* heightfield = static_cast<physx::PxHeightField*>(configuration.GetCachedNativeHeightfield());
+        if (heightfield == nullptr)
+        {
+            return false;
+        }
+
+        // If the heightfield dimensions changed, the sample grid can't be modified in place.
+        int32_t numColumns = 0;
+        int32_t numRows = 0;
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSize, numColumns, numRows);
+        if ((numColumns != configuration.GetNumColumns()) || (numRows != configuration.GetNumRows()))
+        {
+            return false;
+        }
+
+        size_t dirtyStartColumn = 0;
+        size_t dirtyStartRow = 0;
+        size_t dirtyNumColumns = 0;
+        size_t dirtyNumRows = 0;
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+            dirtyRegion, dirtyStartColumn, dirtyStartRow, dirtyNumColumns, dirtyNumRows);
+        if ((dirtyNumColumns == 0) || (dirtyNumRows == 0))
+        {
+            // The dirty region doesn't overlap the heightfield, so there's nothing to update.
+            return true;
+        }
+
+        AZStd::vector<Physics::HeightMaterialPoint> dirtySamples;
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            dirtySamples, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials, dirtyRegion);
+        if (dirtySamples.size() != dirtyNumColumns * dirtyNumRows)
+        {
+            return false;
+        }
+
+        // Patch the modified rows into the cached shape configuration, so that the sample conversion below can read
+        // the neighboring samples and so that any later full rebuild starts from up to date data.
+        AZStd::vector<Physics::HeightMaterialPoint>& samples = configuration.GetSamples();
+        for (size_t row = 0; row < dirtyNumRows; row++)
+        {
+            const auto dirtyRowBegin = dirtySamples.begin() + (row * dirtyNumColumns);
+            AZStd::copy(
+                dirtyRowBegin, dirtyRowBegin + dirtyNumColumns,
+                samples.begin() + ((dirtyStartRow + row) * numColumns) + dirtyStartColumn);
+        }
+
+        AZStd::vector<physx::PxHeightFieldSample> physxSamples;
+        Utils::FillHeightfieldSamples(configuration, dirtyStartColumn, dirtyStartRow, dirtyNumColumns, dirtyNumRows, physxSamples);
+
+        physx::PxHeightFieldDesc subfieldDesc;
+        subfieldDesc.format = physx::PxHeightFieldFormat::eS16_TM;
+        subfieldDesc.nbColumns = static_cast<physx::PxU32>(dirtyNumColumns);
+        subfieldDesc.nbRows = static_cast<physx::PxU32>(dirtyNumRows);
+        subfieldDesc.samples.data = physxSamples.data();
+        subfieldDesc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+        auto heightfieldShape = GetHeightfieldShape();
+        auto* pxShape = heightfieldShape ? static_cast<PhysX::Shape*>(heightfieldShape.get())->GetPxShape() : nullptr;
+        if (pxShape == nullptr)
+        {
+            return false;
+        }
+
+        {
+            PHYSX_SCENE_WRITE_LOCK(pxShape->getActor()->getScene());
+
+            if (!heightfield->modifySamples(
+                static_cast<physx::PxI32>(dirtyStartColumn), static_cast<physx::PxI32>(dirtyStartRow), subfieldDesc))
+            {
+                return false;
+            }
+
+            // Reapply the geometry on the shape so that its bounds and broadphase entry pick up the modified samples.
+            physx::PxHeightFieldGeometry heightfieldGeometry;
+            if (pxShape->getHeightFieldGeometry(heightfieldGeometry))
+            {
+                pxShape->setGeometry(heightfieldGeometry);
+            }
+        }
+
+        Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+        return true;
     }
 
     void HeightfieldColliderComponent::ClearHeightfield()
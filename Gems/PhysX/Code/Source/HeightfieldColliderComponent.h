@@ -87,11 +87,13 @@ namespace PhysX
         AzPhysics::SceneQueryHit RayCast(const AzPhysics::RayCastRequest& request) override;
 
         // HeightfieldProviderNotificationBus
-        void OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion) override;
+        void OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion) override;
 
     private:
         AZStd::shared_ptr<Physics::Shape> GetHeightfieldShape();
 
+        bool UpdateHeightfieldSamples(const AZ::Aabb& dirtyRegion);
+
         void ClearHeightfield();
         void InitHeightfieldShapeConfiguration();
         void InitStaticRigidBody();
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/MeshCookingJobQueue.h>
+
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <PxPhysicsAPI.h>
+#include <Source/Utils.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        //! Hashes the source geometry of a cooking request so that identical meshes share one cache entry.
+        //! The vertex and index counts are folded in so that a convex request (no indices) and a triangle
+        //! mesh request over the same vertex buffer produce different keys.
+        AZ::u64 HashMeshGeometry(const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount)
+        {
+            const auto* vertexBytes = reinterpret_cast<const AZ::u8*>(vertices);
+            AZStd::size_t geometryHash = AZStd::hash_range(vertexBytes, vertexBytes + vertexCount * sizeof(AZ::Vector3));
+            if (indices != nullptr)
+            {
+                const auto* indexBytes = reinterpret_cast<const AZ::u8*>(indices);
+                AZStd::hash_range(geometryHash, indexBytes, indexBytes + indexCount * sizeof(AZ::u32));
+            }
+            AZStd::hash_combine(geometryHash, vertexCount);
+            AZStd::hash_combine(geometryHash, indexCount);
+            return geometryHash;
+        }
+    } // namespace Internal
+
+    MeshCookingJobQueue::~MeshCookingJobQueue()
+    {
+        DrainPendingJobs();
+    }
+
+    void MeshCookingJobQueue::CookConvexMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount, MeshCookedCallback callback)
+    {
+        const AZ::u64 geometryHash = Internal::HashMeshGeometry(vertices, vertexCount, nullptr, 0);
+        AZStd::vector<AZ::Vector3> vertexData(vertices, vertices + vertexCount);
+        SubmitCookJob(
+            geometryHash,
+            [vertexData = AZStd::move(vertexData)](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!Utils::CookConvexToPxOutputStream(
+                        vertexData.data(), static_cast<AZ::u32>(vertexData.size()), memoryStream))
+                {
+                    return false;
+                }
+                cookedData.insert(cookedData.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            },
+            AZStd::move(callback));
+    }
+
+    void MeshCookingJobQueue::CookTriangleMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+        const AZ::u32* indices, AZ::u32 indexCount, MeshCookedCallback callback)
+    {
+        const AZ::u64 geometryHash = Internal::HashMeshGeometry(vertices, vertexCount, indices, indexCount);
+        AZStd::vector<AZ::Vector3> vertexData(vertices, vertices + vertexCount);
+        AZStd::vector<AZ::u32> indexData(indices, indices + indexCount);
+        SubmitCookJob(
+            geometryHash,
+            [vertexData = AZStd::move(vertexData), indexData = AZStd::move(indexData)](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!Utils::CookTriangleMeshToToPxOutputStream(
+                        vertexData.data(), static_cast<AZ::u32>(vertexData.size()),
+                        indexData.data(), static_cast<AZ::u32>(indexData.size()), memoryStream))
+                {
+                    return false;
+                }
+                cookedData.insert(cookedData.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            },
+            AZStd::move(callback));
+    }
+
+    void MeshCookingJobQueue::SubmitCookJob(AZ::u64 geometryHash, CookFunction cookFunction, MeshCookedCallback callback)
+    {
+        bool cacheHit = false;
+        AZStd::vector<AZ::u8> cachedCookedData;
+        {
+            AZStd::scoped_lock lock(m_cacheMutex);
+            if (auto cachedData = m_cookedDataCache.find(geometryHash); cachedData != m_cookedDataCache.end())
+            {
+                // Copy the cached buffer so the callback can be invoked outside the lock.
+                cachedCookedData = cachedData->second;
+                cacheHit = true;
+            }
+            else if (auto pendingCallbacks = m_pendingCallbacks.find(geometryHash); pendingCallbacks != m_pendingCallbacks.end())
+            {
+                // The same geometry is already being cooked - attach to the in-flight job.
+                pendingCallbacks->second.push_back(AZStd::move(callback));
+                return;
+            }
+            else
+            {
+                m_pendingCallbacks[geometryHash].push_back(AZStd::move(callback));
+            }
+        }
+
+        if (cacheHit)
+        {
+            callback(true, cachedCookedData);
+            return;
+        }
+
+        ++m_activeCookingJobs;
+
+        auto cookJob = [this, geometryHash, cookFunction = AZStd::move(cookFunction)]()
+        {
+            AZStd::vector<AZ::u8> cookedData;
+            const bool cookingSucceeded = cookFunction(cookedData);
+
+            AZStd::vector<MeshCookedCallback> callbacks;
+            {
+                AZStd::scoped_lock lock(m_cacheMutex);
+                if (cookingSucceeded)
+                {
+                    m_cookedDataCache.emplace(geometryHash, cookedData);
+                }
+                if (auto pendingCallbacks = m_pendingCallbacks.find(geometryHash); pendingCallbacks != m_pendingCallbacks.end())
+                {
+                    callbacks = AZStd::move(pendingCallbacks->second);
+                    m_pendingCallbacks.erase(pendingCallbacks);
+                }
+            }
+
+            for (MeshCookedCallback& pendingCallback : callbacks)
+            {
+                pendingCallback(cookingSucceeded, cookedData);
+            }
+
+            --m_activeCookingJobs;
+        };
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        if (jobContext == nullptr)
+        {
+            // No job manager is available (e.g. some unit test environments) - cook synchronously.
+            cookJob();
+            return;
+        }
+
+        AZ::Job* job = AZ::CreateJobFunction(AZStd::move(cookJob), true, jobContext);
+        job->Start();
+    }
+
+    void MeshCookingJobQueue::DrainPendingJobs()
+    {
+        while (m_activeCookingJobs.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <PhysX/SystemComponentBus.h>
+
+namespace PhysX
+{
+    //! Cooks convex and triangle meshes on worker jobs so that colliders created at runtime do not
+    //! stall the thread that spawns them.
+    //! Cooked data is cached by a hash of the source geometry, so repeated requests for the same mesh
+    //! (for example spawning many instances of the same prop) are served without cooking again, and
+    //! requests for geometry that is already being cooked are attached to the in-flight job rather
+    //! than cooking the same mesh twice.
+    class MeshCookingJobQueue
+    {
+    public:
+        MeshCookingJobQueue() = default;
+        ~MeshCookingJobQueue();
+
+        //! Cooks a convex mesh on a worker job and invokes the callback with the cooked data.
+        //! The vertex data is copied, so it does not need to outlive the call.
+        //! The callback may be invoked from a worker thread, or before this call returns if the
+        //! geometry is already cached or no job manager is available.
+        void CookConvexMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount, MeshCookedCallback callback);
+
+        //! Cooks a triangle mesh on a worker job and invokes the callback with the cooked data.
+        //! The vertex and index data are copied, so they do not need to outlive the call.
+        //! The callback may be invoked from a worker thread, or before this call returns if the
+        //! geometry is already cached or no job manager is available.
+        void CookTriangleMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, MeshCookedCallback callback);
+
+        //! Blocks until all in-flight cooking jobs have completed and their callbacks have been invoked.
+        //! Must be called before the cooking library is shut down.
+        void DrainPendingJobs();
+
+    private:
+        //! Performs the actual cook, writing the cooked data to the output buffer.
+        //! The function owns a copy of the source geometry, so it can run after the caller has returned.
+        using CookFunction = AZStd::function<bool(AZStd::vector<AZ::u8>& cookedData)>;
+
+        //! Serves the request from the cache if possible, otherwise attaches it to an in-flight job
+        //! for the same geometry or starts a new cooking job.
+        void SubmitCookJob(AZ::u64 geometryHash, CookFunction cookFunction, MeshCookedCallback callback);
+
+        //! Cooked mesh buffers keyed by a hash of the source geometry.
+        AZStd::unordered_map<AZ::u64, AZStd::vector<AZ::u8>> m_cookedDataCache;
+        //! Callbacks waiting on an in-flight cooking job, keyed by the same geometry hash.
+        AZStd::unordered_map<AZ::u64, AZStd::vector<MeshCookedCallback>> m_pendingCallbacks;
+        AZStd::mutex m_cacheMutex; //!< Guards the cache and the pending callback map.
+        AZStd::atomic<AZ::u32> m_activeCookingJobs{ 0 }; //!< Number of cooking jobs in flight.
+    };
+} // namespace PhysX
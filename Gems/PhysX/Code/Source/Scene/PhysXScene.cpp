@@ -8,9 +8,14 @@
 #include <Scene/PhysXScene.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
@@ -41,6 +46,10 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Number of scene query requests processed per job when a batch is split across the job system.
+        //! Each query takes the scene read lock individually; the lock is shared between readers, so the slices run concurrently.
+        constexpr size_t SceneQueryBatchJobGranularity = 8;
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -491,6 +500,12 @@ namespace PhysX
 
     PhysXScene::~PhysXScene()
     {
+        // Asynchronous scene query jobs capture this scene, wait for any in-flight queries before tearing down.
+        while (m_activeAsyncQueries.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
         m_physicsSystemConfigChanged.Disconnect();
 
         s_overlapBuffer.swap({});
@@ -536,6 +551,11 @@ namespace PhysX
             return;
         }
 
+        // Release the previous step's events - they remain pollable through GetFrameCollisionEvents /
+        // GetFrameTriggerEvents until a new step begins.
+        m_simulationEventCallback.FlushQueuedCollisionEvents();
+        m_simulationEventCallback.FlushQueuedTriggerEvents();
+
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationStartEvent::Signaled");
             m_sceneSimuationStartEvent.Signal(m_sceneHandle, deltatime);
@@ -543,18 +563,24 @@ namespace PhysX
 
         m_currentDeltaTime = deltatime;
 
-        PHYSX_SCENE_WRITE_LOCK(m_pxScene);
-        m_pxScene->simulate(deltatime);
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->simulate(deltatime);
+        }
+        m_simulationInProgress = true;
     }
 
     void PhysXScene::FinishSimulation()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
-        if (!IsEnabled())
+        // Guard on the simulation being in flight rather than the enabled flag, as the scene may
+        // have been enabled or disabled by another scene's simulation events since StartSimulation.
+        if (!m_simulationInProgress)
         {
             return;
         }
+        m_simulationInProgress = false;
 
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::CheckResults");
@@ -950,26 +976,127 @@ namespace PhysX
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        results.resize(requests.size());
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        if (jobContext == nullptr || requests.size() <= Internal::SceneQueryBatchJobGranularity)
+        {
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                results[i] = QueryScene(requests[i].get());
+            }
+            return results;
+        }
+
+        // Split the batch across jobs. Each job writes into its own slice of the results,
+        // the hit buffers are thread local, so the slices can be processed concurrently.
+        AZ::JobCompletion jobCompletion(jobContext);
+        for (size_t sliceBegin = 0; sliceBegin < requests.size(); sliceBegin += Internal::SceneQueryBatchJobGranularity)
         {
-            results.emplace_back(QueryScene(request.get()));
+            const size_t sliceEnd = AZStd::min(sliceBegin + Internal::SceneQueryBatchJobGranularity, requests.size());
+            AZ::Job* job = AZ::CreateJobFunction(
+                [this, &requests, &results, sliceBegin, sliceEnd]()
+                {
+                    for (size_t i = sliceBegin; i < sliceEnd; ++i)
+                    {
+                        results[i] = QueryScene(requests[i].get());
+                    }
+                },
+                true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
         }
+        jobCompletion.StartAndWaitForCompletion();
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        if (jobContext == nullptr)
+        {
+            // No job system available, run the query in place. The callback still fires after this call returns true.
+            callback(requestId, QueryScene(request));
+            return true;
+        }
+
+        // The caller owns the request and has to keep it alive until the callback has been triggered.
+        ++m_activeAsyncQueries;
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, requestId, request, callback = AZStd::move(callback)]()
+            {
+                callback(requestId, QueryScene(request));
+                --m_activeAsyncQueries;
+            },
+            true, jobContext);
+        job->Start();
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (requests.empty() || !callback)
+        {
+            return false;
+        }
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        if (jobContext == nullptr)
+        {
+            // No job system available, run the batch in place. The callback still fires after this call returns true.
+            callback(requestId, QuerySceneBatch(requests));
+            return true;
+        }
+
+        // Shared between the worker jobs and the completion job. The requests are copied so the batch stays
+        // alive for the duration of the query, the results are written by index so the list handed to the
+        // callback is in the same order the requests were supplied in.
+        struct AsyncBatchState
+        {
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQueryHitsList m_results;
+        };
+        auto state = AZStd::make_shared<AsyncBatchState>();
+        state->m_requests = requests;
+        state->m_results.resize(requests.size());
+
+        ++m_activeAsyncQueries;
+        AZ::Job* completionJob = AZ::CreateJobFunction(
+            [this, requestId, state, callback = AZStd::move(callback)]()
+            {
+                callback(requestId, AZStd::move(state->m_results));
+                --m_activeAsyncQueries;
+            },
+            true, jobContext);
+
+        const size_t numRequests = state->m_requests.size();
+        for (size_t sliceBegin = 0; sliceBegin < numRequests; sliceBegin += Internal::SceneQueryBatchJobGranularity)
+        {
+            const size_t sliceEnd = AZStd::min(sliceBegin + Internal::SceneQueryBatchJobGranularity, numRequests);
+            AZ::Job* job = AZ::CreateJobFunction(
+                [this, state, sliceBegin, sliceEnd]()
+                {
+                    for (size_t i = sliceBegin; i < sliceEnd; ++i)
+                    {
+                        state->m_results[i] = QueryScene(state->m_requests[i].get());
+                    }
+                },
+                true, jobContext);
+            job->SetDependent(completionJob);
+            job->Start();
+        }
+        completionJob->Start();
+        return true;
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1087,6 +1214,39 @@ namespace PhysX
         return m_pxScene;
     }
 
+    void PhysXScene::InvalidateRetainedEventPointers(const AzPhysics::SimulatedBody* deletedBody)
+    {
+        // The frame's events stay pollable until the next simulation step, so any event referencing
+        // a body deleted before then must have its raw pointers cleared. The handles are left intact
+        // for identification.
+        for (AzPhysics::CollisionEvent& collisionEvent : m_simulationEventCallback.GetQueuedCollisionEvents())
+        {
+            if (collisionEvent.m_body1 == deletedBody)
+            {
+                collisionEvent.m_body1 = nullptr;
+                collisionEvent.m_shape1 = nullptr;
+            }
+            if (collisionEvent.m_body2 == deletedBody)
+            {
+                collisionEvent.m_body2 = nullptr;
+                collisionEvent.m_shape2 = nullptr;
+            }
+        }
+        for (AzPhysics::TriggerEvent& triggerEvent : m_simulationEventCallback.GetQueuedTriggerEvents())
+        {
+            if (triggerEvent.m_triggerBody == deletedBody)
+            {
+                triggerEvent.m_triggerBody = nullptr;
+                triggerEvent.m_triggerShape = nullptr;
+            }
+            if (triggerEvent.m_otherBody == deletedBody)
+            {
+                triggerEvent.m_otherBody = nullptr;
+                triggerEvent.m_otherShape = nullptr;
+            }
+        }
+    }
+
     void PhysXScene::ClearDeferedDeletions()
     {
         // swap the deletions in case the simulated body
@@ -1095,6 +1255,7 @@ namespace PhysX
         deletions.swap(m_deferredDeletions);
         for (auto* simulatedBody : deletions)
         {
+            InvalidateRetainedEventPointers(simulatedBody);
             delete simulatedBody;
         }
 
@@ -1128,9 +1289,7 @@ namespace PhysX
                 triggerEvent.m_otherBody->ProcessTriggerEvent(triggerEvent);
             }
         }
-
-        //cleanup events for next simulate
-        m_simulationEventCallback.FlushQueuedTriggerEvents();
+        //the events are kept until the next simulate so they can be polled with GetFrameTriggerEvents.
     }
 
     void PhysXScene::ProcessCollisionEvents()
@@ -1157,16 +1316,28 @@ namespace PhysX
             if (collision.m_body2 != nullptr)
             {
                 //swap the data as the event expects the trigger body to be body1.
-                //this is ok to do as this event is no longer used after calling TriggerCollisionEvent
                 AZStd::swap(collision.m_bodyHandle1, collision.m_bodyHandle2);
                 AZStd::swap(collision.m_body1, collision.m_body2);
                 AZStd::swap(collision.m_shape1, collision.m_shape2);
                 collision.m_body1->ProcessCollisionEvent(collision);
+
+                //restore the original order, as the event stays pollable with GetFrameCollisionEvents.
+                AZStd::swap(collision.m_bodyHandle1, collision.m_bodyHandle2);
+                AZStd::swap(collision.m_body1, collision.m_body2);
+                AZStd::swap(collision.m_shape1, collision.m_shape2);
             }
         }
+        //the events are kept until the next simulate so they can be polled with GetFrameCollisionEvents.
+    }
 
-        //cleanup events for next simulate
-        m_simulationEventCallback.FlushQueuedCollisionEvents();
+    const AzPhysics::CollisionEventList& PhysXScene::GetFrameCollisionEvents() const
+    {
+        return m_simulationEventCallback.GetQueuedCollisionEvents();
+    }
+
+    const AzPhysics::TriggerEventList& PhysXScene::GetFrameTriggerEvents() const
+    {
+        return m_simulationEventCallback.GetQueuedTriggerEvents();
     }
 
     void PhysXScene::UpdateAzProfilerDataPoints()
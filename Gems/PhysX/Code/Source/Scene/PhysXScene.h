@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsJoint.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
@@ -75,6 +76,14 @@ namespace PhysX
         AzPhysics::SceneHandle GetSceneHandle() const { return m_sceneHandle; }
         const AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>>& GetSimulatedBodyList() const { return m_simulatedBodies; }
 
+        //! Returns the collision events accumulated during the most recent simulation step.
+        //! The list remains valid and unchanged until the next StartSimulation call on this scene,
+        //! so systems can poll a frame's events in one batch rather than handling per-event notifications.
+        const AzPhysics::CollisionEventList& GetFrameCollisionEvents() const;
+        //! Returns the trigger events accumulated during the most recent simulation step.
+        //! The list remains valid and unchanged until the next StartSimulation call on this scene.
+        const AzPhysics::TriggerEventList& GetFrameTriggerEvents() const;
+
         void* GetNativePointer() const override;
 
         physx::PxControllerManager* GetOrCreateControllerManager();
@@ -84,6 +93,7 @@ namespace PhysX
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
 
         void FlushQueuedEvents();
+        void InvalidateRetainedEventPointers(const AzPhysics::SimulatedBody* deletedBody);
         void ClearDeferedDeletions();
         void ProcessTriggerEvents();
         void ProcessCollisionEvents();
@@ -91,6 +101,7 @@ namespace PhysX
         void UpdateAzProfilerDataPoints();
 
         bool m_isEnabled = true;
+        bool m_simulationInProgress = false; //!< True between StartSimulation and FinishSimulation.
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
         float m_currentDeltaTime = 0.0f;
@@ -111,6 +122,7 @@ namespace PhysX
         AZ::u64 m_raycastBufferSize = 32; //!< Maximum number of hits that will be returned from a raycast.
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
+        AZStd::atomic<AZ::u32> m_activeAsyncQueries{ 0 }; //!< Number of asynchronous scene query batches in flight. The scene must outlive them.
 
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
@@ -23,8 +23,24 @@ namespace PhysX
         return m_queuedTriggerEvents;
     }
 
+    const AzPhysics::CollisionEventList& SceneSimulationEventCallback::GetQueuedCollisionEvents() const
+    {
+        return m_queuedCollisionEvents;
+    }
+
+    const AzPhysics::TriggerEventList& SceneSimulationEventCallback::GetQueuedTriggerEvents() const
+    {
+        return m_queuedTriggerEvents;
+    }
+
     void SceneSimulationEventCallback::FlushQueuedCollisionEvents()
     {
+        // Return the contact storage to the pool so the next step's events reuse the capacity
+        // instead of allocating. The event lists themselves retain their capacity through clear().
+        for (AzPhysics::CollisionEvent& collisionEvent : m_queuedCollisionEvents)
+        {
+            m_contactsPool.push_back(AZStd::move(collisionEvent.m_contacts));
+        }
         m_queuedCollisionEvents.clear();
     }
 
@@ -106,6 +122,14 @@ namespace PhysX
                 collision.m_shape1 = shape1;
                 collision.m_shape2 = shape2;
 
+                // Reuse contact storage recycled from a previous step's events when available.
+                if (!m_contactsPool.empty())
+                {
+                    collision.m_contacts = AZStd::move(m_contactsPool.back());
+                    m_contactsPool.pop_back();
+                    collision.m_contacts.clear();
+                }
+
                 // Extract contacts for collision event
                 physx::PxContactPairPoint extractedPoints[MaxPointsToReport];
                 physx::PxU32 contactPointCount = contactPair.extractContacts(extractedPoints, MaxPointsToReport);
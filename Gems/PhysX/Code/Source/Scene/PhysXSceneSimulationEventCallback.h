@@ -25,8 +25,12 @@ namespace PhysX
         //! Accessor to the queued Collision / trigger Events.
         AzPhysics::CollisionEventList& GetQueuedCollisionEvents();
         AzPhysics::TriggerEventList& GetQueuedTriggerEvents();
+        const AzPhysics::CollisionEventList& GetQueuedCollisionEvents() const;
+        const AzPhysics::TriggerEventList& GetQueuedTriggerEvents() const;
 
         //! Clear all queued collision / trigger events.
+        //! The contact storage of the cleared collision events is recycled, so steady-state frames
+        //! queue new events without heap allocations.
         void FlushQueuedCollisionEvents();
         void FlushQueuedTriggerEvents();
 
@@ -41,5 +45,6 @@ namespace PhysX
     private:
         AzPhysics::CollisionEventList m_queuedCollisionEvents; //!< Holds all the collision events the happened until the next call to FlushCollisionEvents;
         AzPhysics::TriggerEventList m_queuedTriggerEvents; //!< Holds all the trigger events the happened until the next call to FlushTriggerEvents;
+        AZStd::vector<AZStd::vector<AzPhysics::Contact>> m_contactsPool; //!< Contact storage recycled from flushed collision events, reused by new events to avoid per-event allocations.
     };
 }
@@ -153,11 +153,21 @@ namespace PhysX
 
         auto simulateScenes = [this](float timeStep)
         {
+            // Start the simulation on all enabled scenes before fetching any results, so the scenes
+            // step concurrently on the PhysX worker threads instead of each one blocking this thread
+            // in turn. FinishSimulation only accesses scenes that were started, as a handler of one
+            // scene's finish event may enable or disable another scene mid-frame.
             for (auto& scenePtr : m_sceneList)
             {
                 if (scenePtr != nullptr && scenePtr->IsEnabled())
                 {
                     scenePtr->StartSimulation(timeStep);
+                }
+            }
+            for (auto& scenePtr : m_sceneList)
+            {
+                if (scenePtr != nullptr)
+                {
                     scenePtr->FinishSimulation();
                 }
             }
@@ -217,6 +217,9 @@ namespace PhysX
         PhysX::SystemRequestsBus::Handler::BusDisconnect();
         Physics::SystemRequestBus::Handler::BusDisconnect();
 
+        // Cooking jobs use the PhysX cooking library, so they must finish before it shuts down below.
+        m_meshCookingJobQueue.DrainPendingJobs();
+
         // Reset material manager
         m_materialManager.ReleaseAllMaterials();
 
@@ -325,6 +328,17 @@ namespace PhysX
         return cookingResult;
     }
 
+    void SystemComponent::CookConvexMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount, MeshCookedCallback callback)
+    {
+        m_meshCookingJobQueue.CookConvexMeshAsync(vertices, vertexCount, AZStd::move(callback));
+    }
+
+    void SystemComponent::CookTriangleMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+        const AZ::u32* indices, AZ::u32 indexCount, MeshCookedCallback callback)
+    {
+        m_meshCookingJobQueue.CookTriangleMeshAsync(vertices, vertexCount, indices, indexCount, AZStd::move(callback));
+    }
+
     physx::PxConvexMesh* SystemComponent::CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
     {
         physx::PxDefaultMemoryInputData inpStream(reinterpret_cast<physx::PxU8*>(const_cast<void*>(cookedMeshData)), bufferSize);
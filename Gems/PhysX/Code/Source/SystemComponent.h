@@ -31,6 +31,7 @@
 #include <Configuration/PhysXSettingsRegistryManager.h>
 #include <DefaultWorldComponent.h>
 #include <Material.h>
+#include <MeshCookingJobQueue.h>
 
 namespace AzPhysics
 {
@@ -78,6 +79,10 @@ namespace PhysX
         physx::PxTriangleMesh* CreateTriangleMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize) override;
         physx::PxHeightField* CreateHeightField(const physx::PxHeightFieldSample* samples, AZ::u32 numRows, AZ::u32 numColumns) override;
 
+        void CookConvexMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount, MeshCookedCallback callback) override;
+        void CookTriangleMeshAsync(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, MeshCookedCallback callback) override;
+
 
         bool CookConvexMeshToFile(const AZStd::string& filePath, const AZ::Vector3* vertices, AZ::u32 vertexCount) override;
         
@@ -137,6 +142,8 @@ namespace PhysX
         AZ::Interface<Physics::CollisionRequests> m_collisionRequests;
         AZ::Interface<Physics::System> m_physicsSystem;
 
+        MeshCookingJobQueue m_meshCookingJobQueue;
+
         PhysXSystem* m_physXSystem = nullptr;
         bool m_isTickingPhysics = false;
         AzPhysics::SystemEvents::OnInitializedEvent::Handler m_onSystemInitializedHandler;
@@ -190,6 +190,20 @@ namespace PhysX
 
         Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId);
 
+        //! Converts a rectangular range of heightfield configuration samples into PhysX heightfield samples.
+        //! The source samples are read from the full sample grid in the configuration, so that the material indices of the
+        //! quads can refer to neighboring samples that fall outside of the requested range.
+        //! @param heightfieldConfig the heightfield shape configuration holding the source samples.
+        //! @param startColumn the first column of the range to convert.
+        //! @param startRow the first row of the range to convert.
+        //! @param numColumns the number of columns in the range to convert.
+        //! @param numRows the number of rows in the range to convert.
+        //! @param physxSamples filled with the numRows * numColumns converted samples in row major order.
+        void FillHeightfieldSamples(
+            const Physics::HeightfieldShapeConfiguration& heightfieldConfig,
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows,
+            AZStd::vector<physx::PxHeightFieldSample>& physxSamples);
+
         namespace Geometry
         {
             using PointList = AZStd::vector<AZ::Vector3>;
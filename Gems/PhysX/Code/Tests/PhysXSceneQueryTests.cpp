@@ -7,6 +7,7 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1009,4 +1010,63 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f),
+            AZ::Vector3(0.0f, 0.0f, -10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //create the raycast requests
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& targetPos : positions)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = targetPos.GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run the query, the callback may be triggered from a worker thread
+        constexpr AzPhysics::SceneQuery::AsyncRequestId asyncRequestId = 42;
+        AzPhysics::SceneQueryHitsList results;
+        AZStd::binary_semaphore callbackComplete;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, asyncRequestId, requests,
+            [&results, &callbackComplete, asyncRequestId](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                EXPECT_EQ(requestId, asyncRequestId); //callback should receive the id the batch was submitted with
+                results = AZStd::move(hits);
+                callbackComplete.release();
+            });
+        EXPECT_TRUE(queued); //the batch should queue successfully
+        ASSERT_TRUE(callbackComplete.try_acquire_for(AZStd::chrono::seconds(30))); //the callback should be triggered
+
+        //verify each result from each request has the expected targeted simulated body
+        EXPECT_EQ(results.size(), requests.size());//results returned should match the requests
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits& requestResult = results[i];
+            const AzPhysics::SimulatedBodyHandle targetHandle = simBodies[i];
+
+            EXPECT_TRUE(requestResult); // should have a result
+            EXPECT_EQ(requestResult.m_hits.size(), 1); // each request should only have 1 hit
+            EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == targetHandle); //returned hit should match expected
+        }
+    }
 }
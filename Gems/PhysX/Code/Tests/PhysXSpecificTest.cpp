@@ -12,6 +12,7 @@
 #include <AzTest/AzTest.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AZTestShared/Utils/Utils.h>
 
@@ -26,6 +27,7 @@
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 
 #include <RigidBodyStatic.h>
+#include <Scene/PhysXScene.h>
 #include <SphereColliderComponent.h>
 #include <Utils.h>
 
@@ -436,6 +438,45 @@ namespace PhysX
         EXPECT_EQ(collisionEnd02.m_shape2, shape01);
     }
 
+    TEST_F(PhysXSpecificTest, CollisionEvents_PolledFrameEvents_MatchPerBodyNotifications)
+    {
+        auto obj01 = TestUtils::AddUnitTestObject<SphereColliderComponent>(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f), "TestSphere01");
+        auto obj02 = TestUtils::AddUnitTestObject<SphereColliderComponent>(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 0.0f), "TestSphere02");
+
+        auto body01 = obj01->FindComponent<RigidBodyComponent>()->GetRigidBody();
+        auto body02 = obj02->FindComponent<RigidBodyComponent>()->GetRigidBody();
+
+        CollisionCallbacksListener listener01(obj01->GetId());
+
+        Physics::RigidBodyRequestBus::Event(obj02->GetId(), &Physics::RigidBodyRequestBus::Events::ApplyLinearImpulse, AZ::Vector3(0.0f, 0.0f, 50.0f));
+
+        auto* physXScene = azdynamic_cast<PhysXScene*>(m_defaultScene);
+        ASSERT_TRUE(physXScene != nullptr);
+
+        // step the simulation one fixed timestep at a time, polling the frame events after each step
+        size_t polledCollisionEventCount = 0;
+        for (int timeStep = 0; timeStep < 500; timeStep++)
+        {
+            TestUtils::UpdateScene(m_defaultScene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+            for (const AzPhysics::CollisionEvent& collisionEvent : physXScene->GetFrameCollisionEvents())
+            {
+                polledCollisionEventCount++;
+
+                // the polled events keep the original body order, regardless of the per-body dispatch
+                EXPECT_TRUE(
+                    (collisionEvent.m_body1 == body01 && collisionEvent.m_body2 == body02) ||
+                    (collisionEvent.m_body1 == body02 && collisionEvent.m_body2 == body01));
+            }
+        }
+
+        // every event seen by the per-body listener should also have been seen through polling
+        const size_t notifiedCollisionEventCount =
+            listener01.m_beginCollisions.size() + listener01.m_persistCollisions.size() + listener01.m_endCollisions.size();
+        EXPECT_GT(polledCollisionEventCount, 0);
+        EXPECT_EQ(polledCollisionEventCount, notifiedCollisionEventCount);
+    }
+
     TEST_F(PhysXSpecificTest, RigidBody_CollisionCallback_SimpleCallbackSphereFallingOnStaticBox)
     {
         auto obj01 = TestUtils::AddUnitTestObject<SphereColliderComponent>(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f), "TestSphere01");
@@ -816,6 +857,52 @@ namespace PhysX
         EXPECT_NE(rigidBody->GetPosition(), initialPosition);
     }
 
+    TEST_F(PhysXSpecificTest, MeshCooking_CookConvexMeshAsync_MatchesSynchronousCookingAndServesCachedRepeats)
+    {
+        // Generate input data
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+
+        // Cook the mesh synchronously to get reference data
+        AZStd::vector<AZ::u8> syncCookedData;
+        bool syncResult = false;
+        Physics::SystemRequestBus::BroadcastResult(syncResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), syncCookedData);
+        EXPECT_TRUE(syncResult);
+
+        // Cook the same mesh asynchronously
+        AZStd::binary_semaphore callbackComplete;
+        bool asyncResult = false;
+        AZStd::vector<AZ::u8> asyncCookedData;
+        PhysX::SystemRequestsBus::Broadcast(&PhysX::SystemRequests::CookConvexMeshAsync,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()),
+            [&asyncResult, &asyncCookedData, &callbackComplete](bool cookingSucceeded, const AZStd::vector<AZ::u8>& cookedData)
+            {
+                asyncResult = cookingSucceeded;
+                asyncCookedData = cookedData;
+                callbackComplete.release();
+            });
+
+        ASSERT_TRUE(callbackComplete.try_acquire_for(AZStd::chrono::seconds(30)));
+        EXPECT_TRUE(asyncResult);
+        EXPECT_EQ(asyncCookedData, syncCookedData);
+
+        // A repeated request for the same geometry should be served from the cache with the same data
+        bool cachedResult = false;
+        AZStd::vector<AZ::u8> cachedCookedData;
+        PhysX::SystemRequestsBus::Broadcast(&PhysX::SystemRequests::CookConvexMeshAsync,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()),
+            [&cachedResult, &cachedCookedData, &callbackComplete](bool cookingSucceeded, const AZStd::vector<AZ::u8>& cookedData)
+            {
+                cachedResult = cookingSucceeded;
+                cachedCookedData = cookedData;
+                callbackComplete.release();
+            });
+
+        ASSERT_TRUE(callbackComplete.try_acquire_for(AZStd::chrono::seconds(30)));
+        EXPECT_TRUE(cachedResult);
+        EXPECT_EQ(cachedCookedData, syncCookedData);
+    }
+
     TEST_F(PhysXSpecificTest, RigidBody_TriangleMeshRigidBodyCreatedFromCookedMesh_CachedMeshObjectCreated)
     {
         // Generate input data
@@ -11,6 +11,8 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
 
@@ -104,6 +106,43 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXSystemFixture, SimulateMultipleScenes_AllScenesStep)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SceneHandleList sceneHandles = physicsSystem->AddScenes(m_sceneConfigs);
+
+        //add a falling rigid body to each scene
+        const AZ::Vector3 initialPosition(0.0f, 0.0f, 100.0f);
+        AZStd::vector<AzPhysics::RigidBody*> fallingBodies;
+        for (AzPhysics::SceneHandle sceneHandle : sceneHandles)
+        {
+            AzPhysics::RigidBodyConfiguration rigidBodyConfig;
+            rigidBodyConfig.m_position = initialPosition;
+            rigidBodyConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+                AZStd::make_shared<Physics::ColliderConfiguration>(),
+                AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+            AzPhysics::SimulatedBodyHandle simBodyHandle = sceneInterface->AddSimulatedBody(sceneHandle, &rigidBodyConfig);
+            fallingBodies.push_back(
+                azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, simBodyHandle)));
+        }
+
+        //run the simulation for a few frames - all scenes are started before any results are fetched
+        const float fixedTimeStep = physicsSystem->GetConfiguration()->m_fixedTimestep;
+        for (int frame = 0; frame < 30; frame++)
+        {
+            physicsSystem->Simulate(fixedTimeStep);
+        }
+
+        //every scene should have stepped its body
+        for (const AzPhysics::RigidBody* fallingBody : fallingBodies)
+        {
+            ASSERT_TRUE(fallingBody != nullptr);
+            EXPECT_LT(fallingBody->GetPosition().GetZ(), initialPosition.GetZ());
+        }
+    }
+
     TEST_F(PhysXSystemFixture, RemovedScene_IsRemoved)
     {
         auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
@@ -61,6 +61,8 @@ set(FILES
     Source/Pipeline/HeightFieldAssetHandler.h
     Source/Pipeline/StreamWrapper.cpp
     Source/Pipeline/StreamWrapper.h
+    Source/MeshCookingJobQueue.h
+    Source/MeshCookingJobQueue.cpp
     Source/Utils.h
     Source/Utils.cpp
     Source/RigidBody.cpp
@@ -135,7 +135,7 @@ namespace Terrain
         Physics::HeightfieldProviderRequestsBus::Handler::BusConnect(entityId);
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusConnect();
 
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(AZ::Aabb::CreateNull());
     }
 
     void TerrainPhysicsColliderComponent::Deactivate()
@@ -165,15 +165,12 @@ namespace Terrain
         return false;
     }
 
-    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange()
+    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion)
     {
-        AZ::Aabb worldSize = AZ::Aabb::CreateNull();
-
-        LmbrCentral::ShapeComponentRequestsBus::EventResult(
-            worldSize, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::GetEncompassingAabb);
-
+        // An invalid dirty region tells the listeners that the heightfield structure itself may have changed,
+        // so the entire heightfield needs to be rebuilt instead of updating the samples within the region.
         Physics::HeightfieldProviderNotificationBus::Broadcast(
-            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, worldSize);
+            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, dirtyRegion);
     }
 
     void TerrainPhysicsColliderComponent::OnShapeChanged([[maybe_unused]] ShapeChangeReasons changeReason)
@@ -182,26 +179,36 @@ namespace Terrain
         // It's important to use this event for transform changes instead of listening to OnTransformChanged, because we need to guarantee
         // the shape has received the transform change message and updated its internal state before passing it along to us.
 
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(AZ::Aabb::CreateNull());
     }
 
     void TerrainPhysicsColliderComponent::OnTerrainDataCreateEnd()
     {
         // The terrain system has finished creating itself, so we should now have data for creating a heightfield.
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(AZ::Aabb::CreateNull());
     }
 
     void TerrainPhysicsColliderComponent::OnTerrainDataDestroyBegin()
     {
         // The terrain system is starting to destroy itself, so notify listeners of a change since the heightfield
         // will no longer have any valid data.
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(AZ::Aabb::CreateNull());
     }
 
     void TerrainPhysicsColliderComponent::OnTerrainDataChanged(
-        [[maybe_unused]] const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
+        const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
     {
-        NotifyListenersOfHeightfieldDataChange();
+        // Color changes don't affect the collision data, so they can be ignored entirely.
+        if ((dataChangedMask & (TerrainDataChangedMask::Settings | TerrainDataChangedMask::HeightData | TerrainDataChangedMask::SurfaceData)) == 0)
+        {
+            return;
+        }
+
+        // Settings changes can alter the heightfield size and resolution, so they require a full rebuild.
+        // Height and surface changes only affect the samples within the dirty region.
+        const AZ::Aabb notifyRegion =
+            (dataChangedMask & TerrainDataChangedMask::Settings) ? AZ::Aabb::CreateNull() : dirtyRegion;
+        NotifyListenersOfHeightfieldDataChange(notifyRegion);
     }
 
     AZ::Aabb TerrainPhysicsColliderComponent::GetHeightfieldAabb() const
@@ -270,19 +277,25 @@ namespace Terrain
 
     void TerrainPhysicsColliderComponent::GenerateHeightsInBounds(AZStd::vector<float>& heights) const
     {
-        AZ_PROFILE_FUNCTION(Entity);
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
 
-        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+        GenerateHeightsInRegion(GetHeightfieldAabb(), gridWidth * gridHeight, heights);
+    }
 
-        AZ::Aabb worldSize = GetHeightfieldAabb();
+    void TerrainPhysicsColliderComponent::GenerateHeightsInRegion(
+        const AZ::Aabb& region, size_t numSamples, AZStd::vector<float>& heights) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-        const float worldCenterZ = worldSize.GetCenter().GetZ();
+        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
 
-        int32_t gridWidth, gridHeight;
-        GetHeightfieldGridSize(gridWidth, gridHeight);
+        // The heights are always relative to the center of the full heightfield bounds, even when only
+        // generating a sub-region of the samples.
+        const float worldCenterZ = GetHeightfieldAabb().GetCenter().GetZ();
 
         heights.clear();
-        heights.reserve(gridWidth * gridHeight);
+        heights.reserve(numSamples);
 
         auto perPositionHeightCallback = [&heights, worldCenterZ]
             ([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
@@ -291,7 +304,7 @@ namespace Terrain
         };
 
         AzFramework::Terrain::TerrainDataRequestBus::Broadcast(&AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegion,
-            worldSize, gridResolution, perPositionHeightCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+            region, gridResolution, perPositionHeightCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
     }
 
     uint8_t TerrainPhysicsColliderComponent::GetMaterialIdIndex(const Physics::MaterialId& materialId, const AZStd::vector<Physics::MaterialId>& materialList) const
@@ -324,22 +337,30 @@ namespace Terrain
 
     void TerrainPhysicsColliderComponent::GenerateHeightsAndMaterialsInBounds(
         AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const
+    {
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
+
+        GenerateHeightsAndMaterialsInRegion(GetHeightfieldAabb(), gridWidth * gridHeight, heightMaterials);
+    }
+
+    void TerrainPhysicsColliderComponent::GenerateHeightsAndMaterialsInRegion(
+        const AZ::Aabb& region, size_t numSamples, AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const
     {
         AZ_PROFILE_FUNCTION(Entity);
 
         const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
 
-        AZ::Aabb worldSize = GetHeightfieldAabb();
+        // The heights and the height bounds are always relative to the full heightfield bounds, even when only
+        // generating a sub-region of the samples.
+        const AZ::Aabb worldSize = GetHeightfieldAabb();
 
         const float worldCenterZ = worldSize.GetCenter().GetZ();
         const float worldHeightBoundsMin = worldSize.GetMin().GetZ();
         const float worldHeightBoundsMax = worldSize.GetMax().GetZ();
 
-        int32_t gridWidth, gridHeight;
-        GetHeightfieldGridSize(gridWidth, gridHeight);
-
         heightMaterials.clear();
-        heightMaterials.reserve(gridWidth * gridHeight);
+        heightMaterials.reserve(numSamples);
 
         AZStd::vector<Physics::MaterialId> materialList = GetMaterialList();
 
@@ -373,7 +394,7 @@ namespace Terrain
         };
 
         AzFramework::Terrain::TerrainDataRequestBus::Broadcast(&AzFramework::Terrain::TerrainDataRequests::ProcessSurfacePointsFromRegion,
-            worldSize, gridResolution, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+            region, gridResolution, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
     }
 
     AZ::Vector2 TerrainPhysicsColliderComponent::GetHeightfieldGridSpacing() const
@@ -446,4 +467,97 @@ namespace Terrain
 
         return heightMaterials;
     }
+
+    void TerrainPhysicsColliderComponent::GetHeightfieldIndicesFromRegion(
+        const AZ::Aabb& dirtyRegion, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const
+    {
+        startColumn = 0;
+        startRow = 0;
+        numColumns = 0;
+        numRows = 0;
+
+        int32_t gridColumns = 0;
+        int32_t gridRows = 0;
+        GetHeightfieldGridSize(gridColumns, gridRows);
+        if ((gridColumns <= 0) || (gridRows <= 0))
+        {
+            return;
+        }
+
+        const AZ::Aabb bounds = GetHeightfieldAabb();
+        const AZ::Aabb clampedRegion = dirtyRegion.GetClamped(bounds);
+        if (!clampedRegion.IsValid())
+        {
+            return;
+        }
+
+        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+
+        // Expand the start of the range by one sample, because the material indices of the quads bordering the
+        // dirty samples refer to them, so those samples need to be recalculated as well.
+        const int64_t firstColumn = AZStd::max<int64_t>(
+            aznumeric_cast<int64_t>(floor((clampedRegion.GetMin().GetX() - bounds.GetMin().GetX()) / gridResolution.GetX())) - 1, 0);
+        const int64_t firstRow = AZStd::max<int64_t>(
+            aznumeric_cast<int64_t>(floor((clampedRegion.GetMin().GetY() - bounds.GetMin().GetY()) / gridResolution.GetY())) - 1, 0);
+
+        const int64_t lastColumn = AZStd::min<int64_t>(
+            aznumeric_cast<int64_t>(ceil((clampedRegion.GetMax().GetX() - bounds.GetMin().GetX()) / gridResolution.GetX())), gridColumns - 1);
+        const int64_t lastRow = AZStd::min<int64_t>(
+            aznumeric_cast<int64_t>(ceil((clampedRegion.GetMax().GetY() - bounds.GetMin().GetY()) / gridResolution.GetY())), gridRows - 1);
+
+        startColumn = aznumeric_cast<size_t>(firstColumn);
+        startRow = aznumeric_cast<size_t>(firstRow);
+        numColumns = aznumeric_cast<size_t>(lastColumn - firstColumn + 1);
+        numRows = aznumeric_cast<size_t>(lastRow - firstRow + 1);
+    }
+
+    AZ::Aabb TerrainPhysicsColliderComponent::GetRegionFromHeightfieldIndices(
+        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const
+    {
+        const AZ::Aabb bounds = GetHeightfieldAabb();
+        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+
+        const float minX = bounds.GetMin().GetX() + (startColumn * gridResolution.GetX());
+        const float minY = bounds.GetMin().GetY() + (startRow * gridResolution.GetY());
+
+        return AZ::Aabb::CreateFromMinMaxValues(
+            minX, minY, bounds.GetMin().GetZ(),
+            minX + (numColumns * gridResolution.GetX()), minY + (numRows * gridResolution.GetY()), bounds.GetMax().GetZ());
+    }
+
+    AZStd::vector<float> TerrainPhysicsColliderComponent::UpdateHeights(const AZ::Aabb& dirtyRegion) const
+    {
+        size_t startColumn = 0;
+        size_t startRow = 0;
+        size_t numColumns = 0;
+        size_t numRows = 0;
+        GetHeightfieldIndicesFromRegion(dirtyRegion, startColumn, startRow, numColumns, numRows);
+
+        AZStd::vector<float> heights;
+        if ((numColumns > 0) && (numRows > 0))
+        {
+            GenerateHeightsInRegion(
+                GetRegionFromHeightfieldIndices(startColumn, startRow, numColumns, numRows), numColumns * numRows, heights);
+        }
+
+        return heights;
+    }
+
+    AZStd::vector<Physics::HeightMaterialPoint> TerrainPhysicsColliderComponent::UpdateHeightsAndMaterials(const AZ::Aabb& dirtyRegion) const
+    {
+        size_t startColumn = 0;
+        size_t startRow = 0;
+        size_t numColumns = 0;
+        size_t numRows = 0;
+        GetHeightfieldIndicesFromRegion(dirtyRegion, startColumn, startRow, numColumns, numRows);
+
+        AZStd::vector<Physics::HeightMaterialPoint> heightMaterials;
+        if ((numColumns > 0) && (numRows > 0))
+        {
+            GenerateHeightsAndMaterialsInRegion(
+                GetRegionFromHeightfieldIndices(startColumn, startRow, numColumns, numRows), numColumns * numRows, heightMaterials);
+        }
+
+        return heightMaterials;
+    }
 }
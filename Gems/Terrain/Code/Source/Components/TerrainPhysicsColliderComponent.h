@@ -86,6 +86,10 @@ namespace Terrain
         AZStd::vector<Physics::MaterialId> GetMaterialList() const override;
         AZStd::vector<float> GetHeights() const override;
         AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const override;
+        void GetHeightfieldIndicesFromRegion(
+            const AZ::Aabb& dirtyRegion, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const override;
+        AZStd::vector<float> UpdateHeights(const AZ::Aabb& dirtyRegion) const override;
+        AZStd::vector<Physics::HeightMaterialPoint> UpdateHeightsAndMaterials(const AZ::Aabb& dirtyRegion) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -101,7 +105,13 @@ namespace Terrain
         void GenerateHeightsInBounds(AZStd::vector<float>& heights) const;
         void GenerateHeightsAndMaterialsInBounds(AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const;
 
-        void NotifyListenersOfHeightfieldDataChange();
+        void GenerateHeightsInRegion(const AZ::Aabb& region, size_t numSamples, AZStd::vector<float>& heights) const;
+        void GenerateHeightsAndMaterialsInRegion(
+            const AZ::Aabb& region, size_t numSamples, AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const;
+
+        AZ::Aabb GetRegionFromHeightfieldIndices(size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const;
+
+        void NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion);
 
         // ShapeComponentNotificationsBus
         void OnShapeChanged(ShapeChangeReasons changeReason) override;
@@ -337,18 +337,18 @@ namespace Terrain
             return;
         }
 
-        if (m_materialInstance && m_materialInstance->CanCompile())
+        AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+        for (auto& view : process.m_views)
         {
-            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
-            for (auto& view : process.m_views)
+            if ((view->GetUsageFlags() & AZ::RPI::View::UsageFlags::UsageCamera) > 0)
             {
-                if ((view->GetUsageFlags() & AZ::RPI::View::UsageFlags::UsageCamera) > 0)
-                {
-                    cameraPosition = view->GetCameraTransform().GetTranslation();
-                    break;
-                }
+                cameraPosition = view->GetCameraTransform().GetTranslation();
+                break;
             }
+        }
 
+        if (m_materialInstance && m_materialInstance->CanCompile())
+        {
             if (m_meshManager.IsInitialized())
             {
                 bool surfacesRebuilt = false;
@@ -391,16 +391,21 @@ namespace Terrain
             m_meshManager.DrawMeshes(process);
         }
 
-        if (m_heightmapImage && m_imageBindingsNeedUpdate)
+        if (m_heightmapImage)
         {
             WorldShaderData worldData;
             m_terrainBounds.GetMin().StoreToFloat3(worldData.m_min.data());
             m_terrainBounds.GetMax().StoreToFloat3(worldData.m_max.data());
-
-            m_imageBindingsNeedUpdate = false;
+            worldData.m_cameraPosition = { cameraPosition.GetX(), cameraPosition.GetY() };
 
             auto sceneSrg = GetParentScene()->GetShaderResourceGroup();
-            sceneSrg->SetImage(m_heightmapPropertyIndex, m_heightmapImage);
+            if (m_imageBindingsNeedUpdate)
+            {
+                m_imageBindingsNeedUpdate = false;
+                sceneSrg->SetImage(m_heightmapPropertyIndex, m_heightmapImage);
+            }
+
+            // The world data is set every frame since it carries the camera position for LOD morphing.
             sceneSrg->SetConstant(m_worldDataIndex, worldData);
         }
 
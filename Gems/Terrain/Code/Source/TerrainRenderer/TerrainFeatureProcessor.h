@@ -65,6 +65,8 @@ namespace Terrain
             float padding1{ 0.0f };
             AZStd::array<float, 3> m_max{ 0.0f, 0.0f, 0.0f };
             float padding2{ 0.0f };
+            AZStd::array<float, 2> m_cameraPosition{ 0.0f, 0.0f }; // xy position of the main camera, used for LOD morphing.
+            AZStd::array<float, 2> padding3{ 0.0f, 0.0f };
         };
 
         // AZ::RPI::MaterialReloadNotificationBus::Handler overrides...
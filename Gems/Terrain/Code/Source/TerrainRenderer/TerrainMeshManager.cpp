@@ -9,6 +9,7 @@
 #include <TerrainRenderer/TerrainMeshManager.h>
 
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/std/limits.h>
 
 #include <Atom/RHI.Reflect/BufferViewDescriptor.h>
 
@@ -61,6 +62,7 @@ namespace Terrain
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         m_patchModel = {};
         m_sectorData.clear();
+        m_sectorAabbs.clear();
         m_rebuildSectors = true;
         m_isInitialized = false;
     }
@@ -74,6 +76,7 @@ namespace Terrain
 
         m_rebuildSectors = false;
         m_sectorData.clear();
+        m_sectorAabbs.clear();
 
         const auto layout = materialInstance->GetAsset()->GetObjectSrgLayout();
 
@@ -98,10 +101,26 @@ namespace Terrain
                 m_sectorData.push_back();
                 SectorData& sectorData = m_sectorData.back();
 
-                for (auto& lod : m_patchModel->GetLods())
+                const auto lods = m_patchModel->GetLods();
+                for (size_t lodIndex = 0; lodIndex < lods.size(); ++lodIndex)
                 {
                     objectSrgData.m_xyScale = m_sampleSpacing * GridSize;
-                        
+                    objectSrgData.m_gridSize = aznumeric_cast<float>(GridSize >> lodIndex);
+
+                    if (lodIndex == lods.size() - 1)
+                    {
+                        // There's no lower density LOD to morph to.
+                        objectSrgData.m_morphStart = AZStd::numeric_limits<float>::max();
+                        objectSrgData.m_morphEnd = AZStd::numeric_limits<float>::max();
+                    }
+                    else
+                    {
+                        // This LOD is used until the camera distance doubles beyond MinDistanceForLod0 one more
+                        // time, so morph toward the next LOD in the last part of that range.
+                        objectSrgData.m_morphEnd = MinDistanceForLod0 * aznumeric_cast<float>(2 << lodIndex);
+                        objectSrgData.m_morphStart = objectSrgData.m_morphEnd * MorphStartRatio;
+                    }
+
                     auto objectSrg = AZ::RPI::ShaderResourceGroup::Create(shaderAsset, materialAsset->GetObjectSrgLayout()->GetName());
                     if (!objectSrg)
                     {
@@ -111,7 +130,7 @@ namespace Terrain
                     objectSrg->SetConstant(patchDataIndex, objectSrgData);
                     objectSrg->Compile();
 
-                    AZ::RPI::ModelLod& modelLod = *lod.get();
+                    AZ::RPI::ModelLod& modelLod = *lods[lodIndex].get();
                     sectorData.m_drawPackets.emplace_back(modelLod, 0, materialInstance, objectSrg);
                     AZ::RPI::MeshDrawPacket& drawPacket = sectorData.m_drawPackets.back();
                         
@@ -132,6 +151,7 @@ namespace Terrain
                         AZ::Vector3(xPatch, yPatch, m_worldBounds.GetMin().GetZ()),
                         AZ::Vector3(xPatch + GridMeters, yPatch + GridMeters, m_worldBounds.GetMax().GetZ())
                     );
+                m_sectorAabbs.push_back(sectorData.m_aabb);
             }
         }
         return true;
@@ -139,42 +159,54 @@ namespace Terrain
     
     void TerrainMeshManager::DrawMeshes(const AZ::RPI::FeatureProcessor::RenderPacket& process)
     {
-        for (auto& sectorData : m_sectorData)
+        if (m_sectorData.empty())
         {
-            uint8_t lodChoice = AZ::RPI::ModelLodAsset::LodCountMax;
+            return;
+        }
 
-            // Go through all cameras and choose an LOD based on the closest camera.
-            for (auto& view : process.m_views)
+        // Go through all cameras and choose an LOD for each sector based on the closest camera.
+        // All cameras should render the same LOD so effects like shadows are consistent.
+        m_sectorLods.assign(m_sectorData.size(), AZ::RPI::ModelLodAsset::LodCountMax);
+        for (auto& view : process.m_views)
+        {
+            if ((view->GetUsageFlags() & AZ::RPI::View::UsageFlags::UsageCamera) == 0)
             {
-                if ((view->GetUsageFlags() & AZ::RPI::View::UsageFlags::UsageCamera) > 0)
-                {
-                    const AZ::Vector3 cameraPosition = view->GetCameraTransform().GetTranslation();
-                    const AZ::Vector2 cameraPositionXY = AZ::Vector2(cameraPosition.GetX(), cameraPosition.GetY());
-                    const AZ::Vector2 sectorCenterXY = AZ::Vector2(sectorData.m_aabb.GetCenter().GetX(), sectorData.m_aabb.GetCenter().GetY());
+                continue;
+            }
 
-                    const float sectorDistance = sectorCenterXY.GetDistance(cameraPositionXY);
+            const AZ::Vector3 cameraPosition = view->GetCameraTransform().GetTranslation();
+            const AZ::Vector2 cameraPositionXY = AZ::Vector2(cameraPosition.GetX(), cameraPosition.GetY());
 
-                    // This will be configurable later
-                    const float minDistanceForLod0 = (GridMeters * 4.0f);
+            for (size_t i = 0; i < m_sectorAabbs.size(); ++i)
+            {
+                const AZ::Vector2 sectorCenterXY = AZ::Vector2(m_sectorAabbs[i].GetCenter().GetX(), m_sectorAabbs[i].GetCenter().GetY());
+                const float sectorDistance = sectorCenterXY.GetDistance(cameraPositionXY);
 
-                    // For every distance doubling beyond a minDistanceForLod0, we only need half the mesh density. Each LOD
-                    // is exactly half the resolution of the last.
-                    const float lodForCamera = AZStd::floorf(AZ::GetMax(0.0f, log2f(sectorDistance / minDistanceForLod0)));
+                // For every distance doubling beyond a MinDistanceForLod0, we only need half the mesh density. Each LOD
+                // is exactly half the resolution of the last. Vertex morphing in the shader hides the transitions.
+                const float lodForCamera = AZStd::floorf(AZ::GetMax(0.0f, log2f(sectorDistance / MinDistanceForLod0)));
 
-                    // All cameras should render the same LOD so effects like shadows are consistent.
-                    lodChoice = AZ::GetMin(lodChoice, aznumeric_cast<uint8_t>(lodForCamera));
-                }
+                m_sectorLods[i] = AZ::GetMin(m_sectorLods[i], aznumeric_cast<uint8_t>(lodForCamera));
             }
+        }
+
+        // Cull all the sector aabbs against each view in one batch and add the draw packets of the visible sectors.
+        m_sectorVisibility.resize_no_construct(m_sectorAabbs.size());
+        for (auto& view : process.m_views)
+        {
+            const AZ::Frustum viewFrustum = AZ::Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+            viewFrustum.IntersectAabbBatch(m_sectorAabbs, m_sectorVisibility);
 
-            // Add the correct LOD draw packet for visible sectors.
-            for (auto& view : process.m_views)
+            for (size_t i = 0; i < m_sectorData.size(); ++i)
             {
-                AZ::Frustum viewFrustum = AZ::Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
-                if (viewFrustum.IntersectAabb(sectorData.m_aabb) != AZ::IntersectResult::Exterior)
+                if (m_sectorVisibility[i] == AZ::IntersectResult::Exterior)
                 {
-                    const uint8_t lodToRender = AZ::GetMin(lodChoice, aznumeric_cast<uint8_t>(sectorData.m_drawPackets.size() - 1));
-                    view->AddDrawPacket(sectorData.m_drawPackets.at(lodToRender).GetRHIDrawPacket());
+                    continue;
                 }
+
+                SectorData& sectorData = m_sectorData[i];
+                const uint8_t lodToRender = AZ::GetMin(m_sectorLods[i], aznumeric_cast<uint8_t>(sectorData.m_drawPackets.size() - 1));
+                view->AddDrawPacket(sectorData.m_drawPackets.at(lodToRender).GetRHIDrawPacket());
             }
         }
     }
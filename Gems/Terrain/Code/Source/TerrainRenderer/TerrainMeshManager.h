@@ -10,6 +10,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Plane.h>
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/std/containers/vector.h>
 
@@ -64,6 +65,12 @@ namespace Terrain
         static constexpr float GridMeters{ GridSpacing * GridSize };
         static constexpr uint32_t MaxMaterialsPerSector = 4;
 
+        // Distance at which sectors switch from LOD 0 to LOD 1. This will be configurable later.
+        static constexpr float MinDistanceForLod0{ GridMeters * 4.0f };
+
+        // Portion of a LOD's distance range after which vertices start morphing to the next LOD.
+        static constexpr float MorphStartRatio{ 0.75f };
+
     private:
         
         struct VertexPosition
@@ -89,6 +96,9 @@ namespace Terrain
         {
             AZStd::array<float, 2> m_xyTranslation{ 0.0f, 0.0f };
             float m_xyScale{ 1.0f };
+            float m_gridSize{ 1.0f }; // Number of quads along one side of this patch's LOD mesh.
+            float m_morphStart{ 0.0f }; // Camera distance where vertices start morphing to the next LOD.
+            float m_morphEnd{ 0.0f }; // Camera distance where the morph to the next LOD completes.
         };
 
         // AzFramework::Terrain::TerrainDataNotificationBus overrides...
@@ -106,6 +116,13 @@ namespace Terrain
 
         AZStd::vector<SectorData> m_sectorData;
         AZ::Data::Instance<AZ::RPI::Model> m_patchModel;
+
+        // Sector aabbs stored contiguously so all sectors can be culled against a view in one batch.
+        AZStd::vector<AZ::Aabb> m_sectorAabbs;
+
+        // Per frame scratch space for culling results and LOD selection.
+        AZStd::vector<AZ::IntersectResult> m_sectorVisibility;
+        AZStd::vector<uint8_t> m_sectorLods;
         
         AZ::Aabb m_worldBounds{ AZ::Aabb::CreateNull() };
         float m_sampleSpacing = 1.0f;
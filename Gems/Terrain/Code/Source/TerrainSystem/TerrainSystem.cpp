@@ -86,6 +86,8 @@ void TerrainSystem::Activate()
         m_registeredAreas.clear();
     }
 
+    InvalidateHeightCache();
+
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
 
     // Register any terrain spawners that were already active before the terrain system activated.
@@ -278,6 +280,130 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     return height;
 }
 
+float TerrainSystem::GetCachedHeight(float x, float y, Sampler sampler, bool& terrainExists) const
+{
+    terrainExists = false;
+    float height = m_currentSettings.m_worldBounds.GetMin().GetZ();
+
+    if (!InWorldBounds(x, y))
+    {
+        return height;
+    }
+
+    switch (sampler)
+    {
+    // Get the value at the requested location, using the terrain grid to bilinear filter between cached sample grid points.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+        {
+            const AZ::Vector2 normalizedPosition = AZ::Vector2(x, y) / m_currentSettings.m_heightQueryResolution;
+            const int32_t xSample = aznumeric_cast<int32_t>(floorf(normalizedPosition.GetX()));
+            const int32_t ySample = aznumeric_cast<int32_t>(floorf(normalizedPosition.GetY()));
+            const AZ::Vector2 normalizedDelta(
+                normalizedPosition.GetX() - floorf(normalizedPosition.GetX()),
+                normalizedPosition.GetY() - floorf(normalizedPosition.GetY()));
+
+            const float heightX0Y0 = GetCachedTerrainAreaHeight(xSample, ySample, terrainExists);
+            const float heightX1Y0 = GetCachedTerrainAreaHeight(xSample + 1, ySample, terrainExists);
+            const float heightX0Y1 = GetCachedTerrainAreaHeight(xSample, ySample + 1, terrainExists);
+            const float heightX1Y1 = GetCachedTerrainAreaHeight(xSample + 1, ySample + 1, terrainExists);
+            const float heightXY0 = AZ::Lerp(heightX0Y0, heightX1Y0, normalizedDelta.GetX());
+            const float heightXY1 = AZ::Lerp(heightX0Y1, heightX1Y1, normalizedDelta.GetX());
+            height = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
+        }
+        break;
+
+    //! Clamp the input point to the terrain sample grid, then get the cached height at the given grid location.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+        {
+            const AZ::Vector2 normalizedPosition = AZ::Vector2(x, y) / m_currentSettings.m_heightQueryResolution;
+            height = GetCachedTerrainAreaHeight(
+                aznumeric_cast<int32_t>(floorf(normalizedPosition.GetX())),
+                aznumeric_cast<int32_t>(floorf(normalizedPosition.GetY())),
+                terrainExists);
+        }
+        break;
+
+    //! Exact queries can land anywhere between the sample grid points, so they always go straight to the terrain areas.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
+        [[fallthrough]];
+    default:
+        height = GetTerrainAreaHeight(x, y, terrainExists);
+        break;
+    }
+
+    return AZ::GetClamp(
+        height, m_currentSettings.m_worldBounds.GetMin().GetZ(), m_currentSettings.m_worldBounds.GetMax().GetZ());
+}
+
+float TerrainSystem::GetCachedTerrainAreaHeight(int32_t xSample, int32_t ySample, bool& terrainExists) const
+{
+    auto floorDiv = [](int32_t value, int32_t divisor)
+    {
+        return (value >= 0) ? (value / divisor) : ((value - divisor + 1) / divisor);
+    };
+
+    const AZStd::pair<int32_t, int32_t> tileKey(floorDiv(xSample, HeightCacheTileSize), floorDiv(ySample, HeightCacheTileSize));
+    const size_t sampleIndex = aznumeric_cast<size_t>(
+        (ySample - tileKey.second * HeightCacheTileSize) * HeightCacheTileSize + (xSample - tileKey.first * HeightCacheTileSize));
+
+    const uint32_t generation = m_heightCacheGeneration.load(AZStd::memory_order_acquire);
+
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_heightCacheMutex);
+        auto tileIt = m_heightCache.find(tileKey);
+        if (tileIt != m_heightCache.end() && tileIt->second.m_generation == generation)
+        {
+            terrainExists = tileIt->second.m_exists[sampleIndex];
+            return tileIt->second.m_heights[sampleIndex];
+        }
+    }
+
+    // Cache miss (or stale tile) - resolve the full tile through the terrain area buses without holding the cache lock, then
+    // publish it. Concurrent resolves of the same tile produce identical data, so last writer wins.
+    const float worldMin = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    HeightCacheTile tile;
+    tile.m_generation = generation;
+    tile.m_heights.resize(HeightCacheTileSize * HeightCacheTileSize, worldMin);
+    tile.m_exists.resize(HeightCacheTileSize * HeightCacheTileSize, false);
+
+    const AZ::Vector2 queryResolution = m_currentSettings.m_heightQueryResolution;
+    for (int32_t y = 0; y < HeightCacheTileSize; y++)
+    {
+        const float fy = aznumeric_cast<float>(tileKey.second * HeightCacheTileSize + y) * queryResolution.GetY();
+        for (int32_t x = 0; x < HeightCacheTileSize; x++)
+        {
+            const float fx = aznumeric_cast<float>(tileKey.first * HeightCacheTileSize + x) * queryResolution.GetX();
+            if (InWorldBounds(fx, fy))
+            {
+                bool sampleExists = false;
+                const size_t index = aznumeric_cast<size_t>(y * HeightCacheTileSize + x);
+                tile.m_heights[index] = GetTerrainAreaHeight(fx, fy, sampleExists);
+                tile.m_exists[index] = sampleExists;
+            }
+        }
+    }
+
+    terrainExists = tile.m_exists[sampleIndex];
+    const float height = tile.m_heights[sampleIndex];
+
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_heightCacheMutex);
+        m_heightCache[tileKey] = AZStd::move(tile);
+    }
+
+    return height;
+}
+
+void TerrainSystem::InvalidateHeightCache()
+{
+    // Bump the generation first so that any tile currently being resolved against the old terrain data gets rejected when it is
+    // next looked up, then drop the stored tiles.
+    m_heightCacheGeneration.fetch_add(1, AZStd::memory_order_acq_rel);
+
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_heightCacheMutex);
+    m_heightCache.clear();
+}
+
 float TerrainSystem::GetHeight(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetHeightSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -690,6 +816,86 @@ void TerrainSystem::ProcessSurfacePointsFromListOfVector2(
     }
 }
 
+void TerrainSystem::QueryListAsync(
+    const AZStd::span<AZ::Vector3>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    AzFramework::Terrain::QueryCompletionCallback onCompleteCallback,
+    Sampler sampleFilter) const
+{
+    if (!perPositionCallback || inPositions.empty())
+    {
+        if (onCompleteCallback)
+        {
+            onCompleteCallback();
+        }
+        return;
+    }
+
+    // Group the positions by height cache tile so that each job resolves one tile through the terrain area buses and answers
+    // every query point that landed in it from the cached height grid.
+    const AZ::Vector2 tileSize = m_currentSettings.m_heightQueryResolution * aznumeric_cast<float>(HeightCacheTileSize);
+    AZStd::map<AZStd::pair<int32_t, int32_t>, AZStd::vector<AZ::Vector3>> tileBuckets;
+    for (const auto& position : inPositions)
+    {
+        const AZStd::pair<int32_t, int32_t> tileKey(
+            aznumeric_cast<int32_t>(floorf(position.GetX() / tileSize.GetX())),
+            aznumeric_cast<int32_t>(floorf(position.GetY() / tileSize.GetY())));
+        tileBuckets[tileKey].push_back(position);
+    }
+
+    auto processTile = [this, perPositionCallback, sampleFilter](const AZStd::vector<AZ::Vector3>& positions)
+    {
+        AzFramework::SurfaceData::SurfacePoint surfacePoint;
+        for (const auto& position : positions)
+        {
+            bool terrainExists = false;
+            surfacePoint.m_position = position;
+            surfacePoint.m_position.SetZ(GetCachedHeight(position.GetX(), position.GetY(), sampleFilter, terrainExists));
+            perPositionCallback(surfacePoint, terrainExists);
+        }
+    };
+
+    // If there's no job manager to fan the tiles out to, process them in place instead.
+    AZ::JobContext* jobContext = nullptr;
+    AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+    if (!jobContext)
+    {
+        for (auto& bucket : tileBuckets)
+        {
+            processTile(bucket.second);
+        }
+        if (onCompleteCallback)
+        {
+            onCompleteCallback();
+        }
+        return;
+    }
+
+    // The completion job runs once every tile job has finished.
+    AZ::Job* completionJob = AZ::CreateJobFunction(
+        [onCompleteCallback]()
+        {
+            if (onCompleteCallback)
+            {
+                onCompleteCallback();
+            }
+        },
+        true, jobContext);
+
+    for (auto& bucket : tileBuckets)
+    {
+        AZ::Job* tileJob = AZ::CreateJobFunction(
+            [processTile, positions = AZStd::move(bucket.second)]()
+            {
+                processTile(positions);
+            },
+            true, jobContext);
+        tileJob->SetDependent(completionJob);
+        tileJob->Start();
+    }
+    completionJob->Start();
+}
+
 AZStd::pair<size_t, size_t> TerrainSystem::GetNumSamplesFromRegion(
     const AZ::Aabb& inRegion,
     const AZ::Vector2& stepSize) const
@@ -834,6 +1040,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     m_dirtyRegion.AddAabb(aabb);
     m_terrainHeightDirty = true;
     m_terrainSurfacesDirty = true;
+    InvalidateHeightCache();
 }
 
 void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
@@ -857,6 +1064,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             }
             return false;
         });
+    InvalidateHeightCache();
 }
 
 void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
@@ -882,6 +1090,11 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
     m_terrainHeightDirty = m_terrainHeightDirty || ((changeMask & Terrain::HeightData) == Terrain::HeightData);
 
     m_terrainSurfacesDirty = m_terrainSurfacesDirty || ((changeMask & Terrain::SurfaceData) == Terrain::SurfaceData);
+
+    if ((changeMask & Terrain::HeightData) == Terrain::HeightData)
+    {
+        InvalidateHeightCache();
+    }
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -935,6 +1148,10 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         if (m_terrainHeightDirty)
         {
             changeMask = static_cast<Terrain::TerrainDataChangedMask>(changeMask | Terrain::TerrainDataChangedMask::HeightData);
+
+            // Settings changes (world bounds, query resolution) can dirty the heights without going through RefreshArea, so make
+            // sure any cached height tiles get dropped here as well.
+            InvalidateHeightCache();
         }
 
         if (m_terrainSurfacesDirty)
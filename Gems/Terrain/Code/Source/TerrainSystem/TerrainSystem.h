@@ -12,9 +12,11 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Aabb.h>
 
@@ -163,6 +165,14 @@ namespace Terrain
             AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
             Sampler sampleFilter = Sampler::DEFAULT) const override;
 
+        //! Given a list of XY coordinates, asynchronously call the provided callback function with the height data corresponding
+        //! to each XY coordinate in the list. The positions are grouped by terrain grid tile, each tile is resolved into a cached
+        //! height grid at most once, and the tiles are processed in parallel on job manager threads.
+        virtual void QueryListAsync(const AZStd::span<AZ::Vector3>& inPositions,
+            AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+            AzFramework::Terrain::QueryCompletionCallback onCompleteCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
+
         //! Returns the number of samples for a given region and step size. The first and second
         //! elements of the pair correspond to the X and Y sample counts respectively.
         virtual AZStd::pair<size_t, size_t> GetNumSamplesFromRegion(const AZ::Aabb& inRegion,
@@ -203,6 +213,12 @@ namespace Terrain
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
         AZ::Vector3 GetNormalSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
 
+        // Height cache helpers for the bulk query APIs. Heights are cached per tile of the terrain sample grid so that each grid
+        // sample only gets resolved through the terrain area buses once, no matter how many query points land in the same tile.
+        float GetCachedHeight(float x, float y, Sampler sampler, bool& terrainExists) const;
+        float GetCachedTerrainAreaHeight(int32_t xSample, int32_t ySample, bool& terrainExists) const;
+        void InvalidateHeightCache();
+
         // AZ::TickBus::Handler overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
@@ -230,5 +246,21 @@ namespace Terrain
 
         mutable AZStd::shared_mutex m_areaMutex;
         AZStd::map<AZ::EntityId, TerrainAreaData, TerrainLayerPriorityComparator> m_registeredAreas;
+
+        // Number of terrain grid samples along one side of a cached height tile.
+        static constexpr int32_t HeightCacheTileSize = 32;
+
+        // Cached heights for one tile of the terrain sample grid. Tiles are stamped with the cache generation they were resolved
+        // against, so tiles filled from stale terrain data get rejected and re-resolved instead of returning outdated heights.
+        struct HeightCacheTile
+        {
+            uint32_t m_generation = 0;
+            AZStd::vector<float> m_heights;
+            AZStd::vector<bool> m_exists;
+        };
+
+        mutable AZStd::shared_mutex m_heightCacheMutex;
+        mutable AZStd::map<AZStd::pair<int32_t, int32_t>, HeightCacheTile> m_heightCache;
+        AZStd::atomic<uint32_t> m_heightCacheGeneration{ 1 };
     };
 } // namespace Terrain
@@ -502,3 +502,101 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderGetHeightsAndM
 
     m_entity.reset();
 }
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderGetHeightfieldIndicesFromRegionReturnsExpandedRange)
+{
+    // Check that the sample index range returned for a dirty region is expanded by one sample at the start
+    // of each dimension and clamped to the heightfield grid.
+    CreateEntity();
+
+    AddTerrainPhysicsColliderAndShapeComponentToEntity();
+
+    m_entity->Activate();
+
+    const float boundsMin = 0.0f;
+    const float boundsMax = 1024.0f;
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(boundsMin), AZ::Vector3(boundsMax));
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    const AZ::Vector2 mockHeightResolution = AZ::Vector2(1.0f);
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
+
+    // A region in the interior of the heightfield should get expanded by one sample at the start of each dimension.
+    const AZ::Aabb dirtyRegion = AZ::Aabb::CreateFromMinMaxValues(4.0f, 8.0f, 0.0f, 8.0f, 16.0f, 1024.0f);
+
+    size_t startColumn = 0;
+    size_t startRow = 0;
+    size_t numColumns = 0;
+    size_t numRows = 0;
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+        dirtyRegion, startColumn, startRow, numColumns, numRows);
+
+    EXPECT_EQ(startColumn, 3);
+    EXPECT_EQ(startRow, 7);
+    EXPECT_EQ(numColumns, 6);
+    EXPECT_EQ(numRows, 10);
+
+    // A region outside of the heightfield bounds shouldn't return any samples.
+    const AZ::Aabb outsideRegion = AZ::Aabb::CreateFromMinMaxValues(2000.0f, 2000.0f, 0.0f, 2010.0f, 2010.0f, 1024.0f);
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+        outsideRegion, startColumn, startRow, numColumns, numRows);
+
+    EXPECT_EQ(numColumns, 0);
+    EXPECT_EQ(numRows, 0);
+
+    m_entity.reset();
+}
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderUpdateHeightsAndMaterialsReturnsRegionSamples)
+{
+    // Check that the TerrainPhysicsCollider only generates the samples within a dirty region.
+    CreateEntity();
+
+    AddTerrainPhysicsColliderAndShapeComponentToEntity();
+
+    m_entity->Activate();
+
+    const float boundsMin = 0.0f;
+    const float boundsMax = 1024.0f;
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(boundsMin), AZ::Vector3(boundsMax));
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    const AZ::Vector2 mockHeightResolution = AZ::Vector2(1.0f);
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
+    ON_CALL(terrainListener, ProcessSurfacePointsFromRegion).WillByDefault(
+        [this](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+        {
+            ProcessRegionLoop(inRegion, stepSize, perPositionCallback, nullptr, 0.0f);
+        }
+    );
+
+    const AZ::Aabb dirtyRegion = AZ::Aabb::CreateFromMinMaxValues(4.0f, 8.0f, 0.0f, 8.0f, 16.0f, 1024.0f);
+
+    size_t startColumn = 0;
+    size_t startRow = 0;
+    size_t numColumns = 0;
+    size_t numRows = 0;
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+        dirtyRegion, startColumn, startRow, numColumns, numRows);
+
+    AZStd::vector<Physics::HeightMaterialPoint> heightsAndMaterials;
+    Physics::HeightfieldProviderRequestsBus::EventResult(
+        heightsAndMaterials, m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials,
+        dirtyRegion);
+
+    // The updated samples should cover exactly the index range reported for the dirty region.
+    EXPECT_EQ(heightsAndMaterials.size(), numColumns * numRows);
+
+    m_entity.reset();
+}
@@ -739,6 +739,60 @@ namespace UnitTest
         terrainSystem->ProcessHeightsFromList(inPositions, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
     }
 
+    TEST_F(TerrainSystemTest, TerrainQueryListAsyncReturnsSameHeightsAsSynchronousQueries)
+    {
+        // QueryListAsync resolves heights through a tiled height cache, so verify that the results it produces match the
+        // uncached synchronous queries, and that the completion callback gets called once all positions are processed.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                // Our generated height will be X + Y.
+                position.SetZ(position.GetX() + position.GetY());
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Build a list of query positions that spans positive and negative space and includes both on-grid and between-grid points.
+        AZStd::vector<AZ::Vector3> inPositions;
+        for (float y = -9.5f; y <= 9.5f; y += 1.25f)
+        {
+            for (float x = -9.5f; x <= 9.5f; x += 1.25f)
+            {
+                inPositions.push_back(AZ::Vector3(x, y, 0.0f));
+            }
+        }
+
+        AZStd::atomic<size_t> numPositionsProcessed(0);
+        auto perPositionCallback =
+            [terrainSystemPtr = terrainSystem.get(), &numPositionsProcessed](
+                const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        {
+            const float expectedHeight = terrainSystemPtr->GetHeightFromFloats(
+                surfacePoint.m_position.GetX(), surfacePoint.m_position.GetY(),
+                AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+            constexpr float epsilon = 0.0001f;
+            EXPECT_NEAR(surfacePoint.m_position.GetZ(), expectedHeight, epsilon);
+            numPositionsProcessed++;
+        };
+
+        AZStd::atomic_bool queryCompleted(false);
+        auto onCompleteCallback = [&queryCompleted]()
+        {
+            queryCompleted = true;
+        };
+
+        terrainSystem->QueryListAsync(
+            inPositions, perPositionCallback, onCompleteCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+
+        // The unit test environment has no job manager, so the query runs to completion before returning.
+        EXPECT_TRUE(queryCompleted);
+        EXPECT_EQ(numPositionsProcessed, inPositions.size());
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessNormalsFromListWithBilinearSamplers)
     {
         // Similar to TerrainProcessHeightsFromListWithBilinearSamplers but for normals